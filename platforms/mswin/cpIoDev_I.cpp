@@ -15,6 +15,7 @@
 //  2012-12-10  asc Creation.
 //  2013-03-31  asc Added support for read and write descriptors being the same.
 //  2013-05-08  asc Added SndLen and RcvLen to Buffer versions of Send() and Recv().
+//  2026-10-16  asc Skipped zero fill of the receive buffer.
 // ----------------------------------------------------------------------------
 
 #include "cpIoDev.h"
@@ -113,7 +114,7 @@ int IoDev::Recv(Buffer &Buf, size_t RcvLen, uint32_t Timeout)
     int rv = k_Error;
 
     // make sure there is enough buffer space to receive the number of octets requested
-    if (Buf.Resize(RcvLen))
+    if (Buf.Resize(RcvLen, false))
     {
         rv = Recv(Buf.c_str(), RcvLen, Timeout);
     }
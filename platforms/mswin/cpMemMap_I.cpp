@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpMemMap_I.cpp
+//
+//  Description:    Memory Page and File Mapping Facility.  This is a
+//                  low dependency page provider for MemManager and
+//                  file mapper for StreamMap.
+//
+//  Platform:       mswin
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added read-only file mapping.
+// ----------------------------------------------------------------------------
+
+#include "cpPlatform.h"
+#include "cpMemMap.h"
+
+namespace cp
+{
+
+// round a size up to a multiple of a power of two granularity
+static size_t RoundUp(size_t Size, size_t Granularity)
+{
+    return (Size + Granularity - 1) & ~(Granularity - 1);
+}
+
+
+// map anonymous read/write memory
+void *MemMap::Map(size_t &Size, bool HugePage)
+{
+    void *pMem = NULL;
+    SYSTEM_INFO info;
+
+    // large pages require the SeLockMemoryPrivilege
+    if (HugePage)
+    {
+        size_t largeSize = GetLargePageMinimum();
+
+        if (largeSize > 0)
+        {
+            size_t size = RoundUp(Size, largeSize);
+
+            pMem = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+            if (pMem != NULL)
+            {
+                Size = size;
+                return pMem;
+            }
+        }
+    }
+
+    // fall back to normal pages
+    GetSystemInfo(&info);
+    Size = RoundUp(Size, info.dwPageSize);
+
+    return VirtualAlloc(NULL, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+
+// release memory returned by Map()
+bool MemMap::Unmap(void *Ptr, size_t Size)
+{
+    (void)Size;
+
+    return (VirtualFree(Ptr, 0, MEM_RELEASE) != 0);
+}
+
+
+// touch every page so later accesses do not fault
+void MemMap::Prefault(void *Ptr, size_t Size)
+{
+    SYSTEM_INFO info;
+    volatile char *pMem = reinterpret_cast<volatile char *>(Ptr);
+
+    GetSystemInfo(&info);
+
+    for (size_t i = 0; i < Size; i += info.dwPageSize)
+    {
+        pMem[i] = pMem[i];
+    }
+}
+
+
+// lock pages in physical memory
+bool MemMap::Lock(void *Ptr, size_t Size)
+{
+    return (VirtualLock(Ptr, Size) != 0);
+}
+
+
+// map a file with private copy-on-write pages
+bool MemMap::MapFile(char const *Path, void * &Ptr, size_t &Size, bool Sequential)
+{
+    HANDLE hFile = INVALID_HANDLE_VALUE;
+    HANDLE hMap = NULL;
+    LARGE_INTEGER len;
+    bool rv = false;
+
+    Ptr = NULL;
+    Size = 0;
+
+    hFile = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                        Sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    if (GetFileSizeEx(hFile, &len) && (static_cast<uint64_t>(len.QuadPart) <= SIZE_MAX))
+    {
+        rv = true;
+        Size = static_cast<size_t>(len.QuadPart);
+
+        // an empty file cannot be mapped and needs no mapping
+        if (Size > 0)
+        {
+            hMap = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+            if (hMap != NULL)
+            {
+                Ptr = MapViewOfFile(hMap, FILE_MAP_COPY, 0, 0, 0);
+                CloseHandle(hMap);
+            }
+
+            if (Ptr == NULL)
+            {
+                rv = false;
+                Size = 0;
+            }
+        }
+    }
+
+    // the view holds its own reference to the file
+    CloseHandle(hFile);
+
+    return rv;
+}
+
+
+// release a mapping returned by MapFile()
+bool MemMap::UnmapFile(void *Ptr, size_t Size)
+{
+    (void)Size;
+
+    return (UnmapViewOfFile(Ptr) != 0);
+}
+
+}   // namespace cp
@@ -17,6 +17,7 @@
 //  2012-12-11  asc Added timeout parameter to SendData() and recvData().
 //  2013-03-31  asc Added support for read and write descriptors being the same.
 //  2013-05-08  asc Added SndLen and RcvLen to Buffer versions of Send() and Recv().
+//  2026-10-16  asc Skipped zero fill of the receive buffer.
 // ----------------------------------------------------------------------------
 
 #include <sys/time.h>
@@ -117,7 +118,7 @@ int IoDev::Recv(Buffer &Buf, size_t RcvLen, uint32_t Timeout)
     int rv = k_Error;
 
     // make sure there is enough buffer space to receive the number of octets requested
-    if (Buf.Resize(RcvLen))
+    if (Buf.Resize(RcvLen, false))
     {
         rv = Recv(Buf.c_str(), RcvLen, Timeout);
     }
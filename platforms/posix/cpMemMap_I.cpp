@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpMemMap_I.cpp
+//
+//  Description:    Memory Page and File Mapping Facility.  This is a
+//                  low dependency page provider for MemManager and
+//                  file mapper for StreamMap.
+//
+//  Platform:       posix
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added read-only file mapping.
+// ----------------------------------------------------------------------------
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "cpMemMap.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace cp
+{
+
+// size of a huge page when the system does not report one
+static size_t const k_HugePageSize = 2 * 1024 * 1024;
+
+
+// round a size up to a multiple of a power of two granularity
+static size_t RoundUp(size_t Size, size_t Granularity)
+{
+    return (Size + Granularity - 1) & ~(Granularity - 1);
+}
+
+
+// map anonymous read/write memory
+void *MemMap::Map(size_t &Size, bool HugePage)
+{
+    void *pMem = MAP_FAILED;
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+#ifdef MAP_HUGETLB
+    // explicit huge pages are only available when the administrator reserved them
+    if (HugePage)
+    {
+        size_t hugeSize = RoundUp(Size, k_HugePageSize);
+
+        pMem = mmap(NULL, hugeSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (pMem != MAP_FAILED)
+        {
+            Size = hugeSize;
+            return pMem;
+        }
+    }
+#endif
+
+    // fall back to normal pages
+    Size = RoundUp(Size, pageSize);
+    pMem = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (pMem == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+#ifdef MADV_HUGEPAGE
+    // ask for transparent huge pages, failure just leaves normal pages
+    if (HugePage)
+    {
+        madvise(pMem, Size, MADV_HUGEPAGE);
+    }
+#endif
+
+    return pMem;
+}
+
+
+// release memory returned by Map()
+bool MemMap::Unmap(void *Ptr, size_t Size)
+{
+    return (munmap(Ptr, Size) == 0);
+}
+
+
+// touch every page so later accesses do not fault
+void MemMap::Prefault(void *Ptr, size_t Size)
+{
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile char *pMem = reinterpret_cast<volatile char *>(Ptr);
+
+    for (size_t i = 0; i < Size; i += pageSize)
+    {
+        pMem[i] = pMem[i];
+    }
+}
+
+
+// lock pages in physical memory
+bool MemMap::Lock(void *Ptr, size_t Size)
+{
+    return (mlock(Ptr, Size) == 0);
+}
+
+
+// map a file with private copy-on-write pages
+bool MemMap::MapFile(char const *Path, void * &Ptr, size_t &Size, bool Sequential)
+{
+    struct stat info;
+    bool rv = false;
+    int fd = open(Path, O_RDONLY);
+
+    Ptr = NULL;
+    Size = 0;
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if ((fstat(fd, &info) == 0) && (static_cast<uint64_t>(info.st_size) <= SIZE_MAX))
+    {
+        rv = true;
+        Size = static_cast<size_t>(info.st_size);
+
+        // an empty file cannot be mapped and needs no mapping
+        if (Size > 0)
+        {
+            void *pMem = mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            if (pMem == MAP_FAILED)
+            {
+                rv = false;
+                Size = 0;
+            }
+            else
+            {
+                Ptr = pMem;
+
+#ifdef MADV_SEQUENTIAL
+                // read ahead aggressively and drop pages behind the reader
+                if (Sequential)
+                {
+                    madvise(pMem, Size, MADV_SEQUENTIAL);
+                }
+#endif
+            }
+        }
+    }
+
+    // the mapping holds its own reference to the file
+    close(fd);
+
+#ifndef MADV_SEQUENTIAL
+    (void)Sequential;
+#endif
+
+    return rv;
+}
+
+
+// release a mapping returned by MapFile()
+bool MemMap::UnmapFile(void *Ptr, size_t Size)
+{
+    return (munmap(Ptr, Size) == 0);
+}
+
+}   // namespace cp
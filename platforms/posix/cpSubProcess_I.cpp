@@ -19,6 +19,7 @@
 //  2022-06-12  asc Added detection of subprocess termination and handling.
 //  2022-06-14  asc Increased read buffer size and removed string terminator on each read.
 //  2024-05-10  asc Improved exit path logic and resource lifetime.
+//  2026-10-16  asc Moved the receive buffer out in StreamBufTransfer().
 // ----------------------------------------------------------------------------
 
 // (.)(.) 2022-02-03 asc Need to implement the k_FlowIn mode.
@@ -155,7 +156,7 @@ void SubProcess::BufferExtract(Buffer &Buf)
 void SubProcess::StreamBufTransfer(StreamBuf &Dest)
 {
     m_SyncIo.Lock();
-    Dest.TransferBlocksFrom(m_RxBuffer);
+    Dest = std::move(m_RxBuffer);
     m_SyncIo.Unlock();
 }
 
@@ -14,18 +14,30 @@
 //  History:
 //  2010-10-10  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
+//  2026-10-16  asc Made allocator stateful to carry its MemManager arena.
+//  2026-10-16  asc Added allocation from a MemRegion.
+//  2026-10-16  asc Added variadic construct() and allocator_traits properties.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_ALLOC_H
 #define CP_ALLOC_H
 
 #include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-#include "cpMemMgr.h"
+#include "cpMemRegion.h"
 
 namespace cp
 {
 
+// The allocator carries a pointer to the MemManager arena it draws from.  A
+// default constructed allocator uses the process-wide instance.  An allocator
+// constructed from a MemRegion draws from the region instead, and frees
+// nothing.  Allocators compare equal when they share an arena and region.  The
+// arena follows a container on move assignment and swap, but not on copy
+// assignment.
 template<class T>
 class Alloc
 {
@@ -38,11 +50,24 @@ public:
     typedef const T  &const_reference;
     typedef T         value_type;
 
-    Alloc() throw()
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::true_type  propagate_on_container_move_assignment;
+    typedef std::true_type  propagate_on_container_swap;
+    typedef std::false_type is_always_equal;
+
+    Alloc() throw() : m_Arena(MemManager::InstanceGet()), m_Region(NULL)
+    {
+    }
+
+    explicit Alloc(MemManager *Arena) throw() : m_Arena(Arena), m_Region(NULL)
     {
     }
 
-    Alloc(const Alloc &) throw()
+    explicit Alloc(MemRegion *Region) throw() : m_Arena(MemManager::InstanceGet()), m_Region(Region)
+    {
+    }
+
+    Alloc(const Alloc &Other) throw() : m_Arena(Other.m_Arena), m_Region(Other.m_Region)
     {
     }
 
@@ -58,7 +83,11 @@ public:
         // avoid compiler warning
         (void)p;
 
-        if (MemManager::InstanceGet()->MemBlockGet(pBlk, (n * sizeof(T))))
+        if (m_Region != NULL)
+        {
+            pMem = reinterpret_cast<char *>(m_Region->Allocate(n * sizeof(T)));
+        }
+        else if (m_Arena->MemBlockGet(pBlk, (n * sizeof(T))))
         {
             pMem = pBlk->BuffGet();
         }
@@ -72,9 +101,10 @@ public:
     {
         char *pMem = reinterpret_cast<char * &>(p);
 
+        // region blocks are ignored on return
         if (pMem)
         {
-            MemManager::InstanceGet()->MemBlockPut(pMem);
+            m_Arena->MemBlockPut(pMem);
 //            std::cout << "  used Alloc to deallocate at address " << p << " (-)" << std::endl;
         }
     }
@@ -89,19 +119,32 @@ public:
         return &x;
     }
 
-    Alloc<T> &operator=(const Alloc &)
+    MemManager *ArenaGet() const
+    {
+        return m_Arena;
+    }
+
+    MemRegion *RegionGet() const
     {
+        return m_Region;
+    }
+
+    Alloc<T> &operator=(const Alloc &Other)
+    {
+        m_Arena = Other.m_Arena;
+        m_Region = Other.m_Region;
         return *this;
     }
 
-    void construct(pointer p, const T &val)
+    // constructs in place from any arguments, so containers can emplace and move
+    template<class U, class... Args> void construct(U *p, Args &&... args)
     {
-        new ((T *) p) T(val);
+        ::new ((void *) p) U(std::forward<Args>(args)...);
     }
 
-    void destroy(pointer p)
+    template<class U> void destroy(U *p)
     {
-        p->~T();
+        p->~U();
     }
 
     size_type max_size() const
@@ -114,26 +157,32 @@ public:
         typedef Alloc<U> other;
     };
 
-    template<class U> Alloc(const Alloc<U> &)
+    template<class U> Alloc(const Alloc<U> &Other) throw() : m_Arena(Other.ArenaGet()), m_Region(Other.RegionGet())
     {
     }
 
-    template<class U> Alloc &operator=(const Alloc<U> &)
+    template<class U> Alloc &operator=(const Alloc<U> &Other)
     {
+        m_Arena = Other.ArenaGet();
+        m_Region = Other.RegionGet();
         return *this;
     }
+
+private:
+    MemManager         *m_Arena;                            // memory manager that supplies the blocks
+    MemRegion          *m_Region;                           // region that supplies the blocks (if not NULL)
 };
 
 template <class T1, class T2>
-bool operator==(Alloc<T1> const &, Alloc<T2> const &) throw()
+bool operator==(Alloc<T1> const &Lhs, Alloc<T2> const &Rhs) throw()
 {
-    return true;
+    return ((Lhs.ArenaGet() == Rhs.ArenaGet()) && (Lhs.RegionGet() == Rhs.RegionGet()));
 }
 
 template <class T1, class T2>
-bool operator!=(Alloc<T1> const &, Alloc<T2> const &) throw()
+bool operator!=(Alloc<T1> const &Lhs, Alloc<T2> const &Rhs) throw()
 {
-    return false;
+    return ((Lhs.ArenaGet() != Rhs.ArenaGet()) || (Lhs.RegionGet() != Rhs.RegionGet()));
 }
 
 }   // namespace cp
@@ -20,6 +20,10 @@
 //  2013-04-22  asc Removed duplicated code from StreamBase conversion assignment.
 //  2013-06-08  asc Added m_PtrBlock validity check before CopyOut() references it.
 //  2022-02-03  asc Removed unnecessary assignment.
+//  2026-10-16  asc Made copies share the memory block until one of them is written.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Added content-preserving growth and resize without zero fill.
+//  2026-10-16  asc Held small payloads inline instead of in a memory block.
 // ----------------------------------------------------------------------------
 
 #include "cpStreamBase.h"
@@ -33,7 +37,8 @@ namespace cp
 // constructor
 Buffer::Buffer(size_t Size) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     Resize(Size);
 }
@@ -42,16 +47,29 @@ Buffer::Buffer(size_t Size) :
 // copy constructors
 Buffer::Buffer(Buffer const &rhs) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     // invoke assignment operator
     *this = rhs;
 }
 
 
+// move constructor
+Buffer::Buffer(Buffer &&rhs) :
+    m_PtrBlock(NULL),
+    m_DataLen(0),
+    m_Local(false)
+{
+    // invoke move assignment operator
+    *this = std::move(rhs);
+}
+
+
 Buffer::Buffer(StreamBase &rhs) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     // invoke assignment operator
     *this = rhs;
@@ -60,7 +78,8 @@ Buffer::Buffer(StreamBase &rhs) :
 
 Buffer::Buffer(String const &rhs) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     // invoke assignment operator
     *this = rhs;
@@ -69,7 +88,8 @@ Buffer::Buffer(String const &rhs) :
 
 Buffer::Buffer(char const *rhs) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     // invoke assignment operator
     *this = rhs;
@@ -78,7 +98,8 @@ Buffer::Buffer(char const *rhs) :
 
 Buffer::Buffer(uint8_t const *rhs) :
     m_PtrBlock(NULL),
-    m_DataLen(0)
+    m_DataLen(0),
+    m_Local(false)
 {
     // invoke assignment operator
     *this = rhs;
@@ -108,19 +129,30 @@ size_t Buffer::Size() const
     {
         rv = m_PtrBlock->SizeGet();
     }
+    else if (m_Local)
+    {
+        rv = k_InlineSize;
+    }
 
     return rv;
 }
 
 
+// determine if the memory block is shared
+bool Buffer::IsShared() const
+{
+    return ((m_PtrBlock != NULL) && (m_PtrBlock->RefGet() > 1));
+}
+
+
 // calculate the CRC-32 of the buffer contents
 uint32_t Buffer::Crc32Get()
 {
     uint32_t crc = 0;
 
-    if (m_PtrBlock != NULL)
+    if (Storage() != NULL)
     {
-        crc = cp::CalcCrc32(u_str(), m_DataLen);
+        crc = cp::CalcCrc32(Storage(), m_DataLen);
     }
 
     return crc;
@@ -132,9 +164,12 @@ char *Buffer::c_str(size_t Offset)
 {
     char *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = (m_PtrBlock->BuffGet() + Offset);
+        rv = (Storage() + Offset);
     }
 
     return rv;
@@ -146,9 +181,9 @@ char const *Buffer::c_str(size_t Offset) const
 {
     char *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    if (Storage() != NULL)
     {
-        rv = (m_PtrBlock->BuffGet() + Offset);
+        rv = (Storage() + Offset);
     }
 
     return rv;
@@ -160,9 +195,12 @@ uint8_t *Buffer::u_str(size_t Offset)
 {
     uint8_t *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<uint8_t *>(m_PtrBlock->BuffGet() + Offset);
+        rv = reinterpret_cast<uint8_t *>(Storage() + Offset);
     }
 
     return rv;
@@ -174,9 +212,9 @@ uint8_t const *Buffer::u_str(size_t Offset) const
 {
     uint8_t *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<uint8_t *>(m_PtrBlock->BuffGet() + Offset);
+        rv = reinterpret_cast<uint8_t *>(Storage() + Offset);
     }
 
     return rv;
@@ -189,9 +227,9 @@ bool Buffer::CopyOut(uint8_t *pBuf, size_t Size) const
     bool rv = false;
     size_t length = 0;
 
-    if ((pBuf != NULL) && (m_PtrBlock != NULL))
+    if ((pBuf != NULL) && (Storage() != NULL))
     {
-        length = m_PtrBlock->SizeGet();
+        length = this->Size();
 
         // copy buffer size or amount requested, whichever is less
         if (length > Size)
@@ -199,7 +237,7 @@ bool Buffer::CopyOut(uint8_t *pBuf, size_t Size) const
             length = Size;
         }
 
-        memcpy(pBuf, m_PtrBlock->BuffGet(), length);
+        memcpy(pBuf, Storage(), length);
         rv = true;
     }
 
@@ -210,10 +248,23 @@ bool Buffer::CopyOut(uint8_t *pBuf, size_t Size) const
 // zero or fill the memory buffer
 void Buffer::Clear(int Val)
 {
+    // a shared block is simply let go, since its contents are discarded
+    if (IsShared())
+    {
+        size_t size = m_PtrBlock->SizeGet();
+
+        BlockRelease();
+        Resize(size);
+    }
+
     if (m_PtrBlock != NULL)
     {
         m_PtrBlock->Clear(Val);
     }
+    else if (m_Local)
+    {
+        memset(m_Inline, Val, k_InlineSize);
+    }
 
     m_DataLen = 0;
 }
@@ -222,47 +273,59 @@ void Buffer::Clear(int Val)
 // set the data length
 void Buffer::LenSet(size_t Len)
 {
-    if (m_PtrBlock != NULL)
+    size_t size = Size();
+
+    if (Len < size)
     {
-        if (Len < m_PtrBlock->SizeGet())
-        {
-            m_DataLen = Len;
-        }
-        else
-        {
-            m_DataLen = m_PtrBlock->SizeGet();
-        }
+        m_DataLen = Len;
     }
     else
     {
-        m_DataLen = 0;
+        m_DataLen = size;
     }
 }
 
 
 // acquire a new memory block
-bool Buffer::Resize(size_t NewSize)
+bool Buffer::Resize(size_t NewSize, bool ZeroFill)
 {
-    // don't take any action if sizes are the same or only slightly larger
-    if ((m_PtrBlock != NULL) && (m_PtrBlock->SizeGet() >= NewSize)
-        && (NewSize > 0) && ((m_PtrBlock->SizeGet() / NewSize) < 2.0))
+    // small sizes are held inline
+    if ((NewSize > 0) && (NewSize <= k_InlineSize))
     {
-        return true;
-    }
+        // don't take any action if already inline
+        if (m_Local)
+        {
+            return true;
+        }
 
-    // return any existing memory buffer
-    if (m_PtrBlock != NULL)
-    {
-        if (MemManager::InstanceGet()->MemBlockPut(m_PtrBlock) == false)
+        BlockRelease();
+        m_Local = true;
+
+        if (ZeroFill)
         {
-            LogErr << "Buffer::Resize(): Failed to return a MemBlock of size: "
-                   << m_PtrBlock->SizeGet() << ", block address: " << m_PtrBlock
-                   << ", cp::Buffer instance: " << this << std::endl;
+            Clear();
+        }
+        else
+        {
+            m_DataLen = 0;
         }
 
-        m_PtrBlock = NULL;
+        return true;
     }
 
+    // don't take any action if sizes are the same or only slightly larger
+    // (other than taking a private copy of a shared block that is kept,
+    // which is pointless if the caller will overwrite it)
+    if ((m_PtrBlock != NULL) && (m_PtrBlock->SizeGet() >= NewSize)
+        && (NewSize > 0) && ((m_PtrBlock->SizeGet() / NewSize) < 2.0)
+        && (ZeroFill || (IsShared() == false)))
+    {
+        return Unshare();
+    }
+
+    // return any existing memory buffer
+    BlockRelease();
+
     // acquire another memory buffer
     if (NewSize > 0)
     {
@@ -271,21 +334,89 @@ bool Buffer::Resize(size_t NewSize)
             LogErr << "Buffer::Resize(): Failed to acquire a MemBlock of size: "
                    << NewSize << ", cp::Buffer instance: " << this << std::endl;
         }
+        else
+        {
+            m_PtrBlock->RefSet(1);
+        }
     }
 
     // clear the memory buffer
-    Clear();
+    if (ZeroFill)
+    {
+        Clear();
+    }
+    else
+    {
+        m_DataLen = 0;
+    }
 
     return ((m_PtrBlock != NULL) || (NewSize == 0));
 }
 
 
+// grow the memory block, keeping the contents
+// (the space beyond the data is not cleared)
+bool Buffer::Reserve(size_t NewSize)
+{
+    // the block already has room
+    if (Size() >= NewSize)
+    {
+        return true;
+    }
+
+    // an empty Buffer can start out inline
+    if ((Storage() == NULL) && (NewSize <= k_InlineSize))
+    {
+        m_Local = true;
+        return true;
+    }
+
+    return Relocate(NewSize);
+}
+
+
+// append data, growing the memory block as needed
+bool Buffer::Append(uint8_t const *pBuf, size_t Len)
+{
+    size_t need = m_DataLen + Len;
+
+    if ((pBuf == NULL) && (Len > 0))
+    {
+        return false;
+    }
+
+    // grow geometrically so repeated appends copy the data a bounded number of times
+    if (need > Size())
+    {
+        size_t grow = Size() * 2;
+
+        if (Reserve((grow > need) ? grow : need) == false)
+        {
+            return false;
+        }
+    }
+
+    if (Len > 0)
+    {
+        if (Unshare() == false)
+        {
+            return false;
+        }
+
+        memcpy(Storage() + m_DataLen, pBuf, Len);
+        m_DataLen = need;
+    }
+
+    return true;
+}
+
+
 // copy data into the buffer
 bool Buffer::CopyIn(uint8_t const *pBuf, size_t Len)
 {
     if ((pBuf != NULL) && Resize(Len))
     {
-        memcpy(m_PtrBlock->BuffGet(), pBuf, Len);
+        memcpy(Storage(), pBuf, Len);
         m_DataLen = Len;
         return true;
     }
@@ -299,17 +430,21 @@ bool Buffer::CopyIn(uint8_t const *pBuf, size_t Len)
 // move memory block to destination Buffer
 void Buffer::XferMemBlk(Buffer &Dest)
 {
-    Dest.Resize(0);
-    Dest.m_PtrBlock = m_PtrBlock;
-    Dest.m_DataLen = m_DataLen;
-    m_PtrBlock = NULL;
-    m_DataLen = 0;
+    Dest = std::move(*this);
 }
 
 
 // extract memory block from Buffer
 MemBlock *Buffer::GetMemBlk()
 {
+    // the caller receives sole ownership of a block
+    if (m_Local)
+    {
+        Relocate(k_InlineSize);
+    }
+
+    Unshare();
+
     MemBlock *p = m_PtrBlock;
 
     m_PtrBlock = NULL;
@@ -326,7 +461,65 @@ void Buffer::SetMemBlk(MemBlock *pBlock)
     {
         Resize(0);
         m_PtrBlock = pBlock;
+        m_PtrBlock->RefSet(1);
+    }
+}
+
+
+// make a private copy of a shared memory block
+bool Buffer::Unshare()
+{
+    MemBlock *pBlock = NULL;
+
+    if (IsShared() == false)
+    {
+        return true;
+    }
+
+    size_t size = m_PtrBlock->SizeGet();
+
+    if (MemManager::InstanceGet()->MemBlockGet(pBlock, size) == false)
+    {
+        LogErr << "Buffer::Unshare(): Failed to acquire a MemBlock of size: "
+               << size << ", cp::Buffer instance: " << this << std::endl;
+        return false;
     }
+
+    // copy the data and clear the remainder as a fresh block would be
+    memcpy(pBlock->BuffGet(), m_PtrBlock->BuffGet(), m_DataLen);
+    memset(pBlock->BuffGet() + m_DataLen, 0, pBlock->SizeGet() - m_DataLen);
+    pBlock->RefSet(1);
+
+    // the other owners keep the original
+    m_PtrBlock->RefDec();
+    m_PtrBlock = pBlock;
+
+    return true;
+}
+
+
+// give up the memory block or inline storage
+void Buffer::BlockRelease()
+{
+    m_Local = false;
+
+    if (m_PtrBlock == NULL)
+    {
+        return;
+    }
+
+    // the last owner returns the block
+    if ((m_PtrBlock->RefGet() <= 1) || (m_PtrBlock->RefDec() == 0))
+    {
+        if (MemManager::InstanceGet()->MemBlockPut(m_PtrBlock) == false)
+        {
+            LogErr << "Buffer::BlockRelease(): Failed to return a MemBlock of size: "
+                   << m_PtrBlock->SizeGet() << ", block address: " << m_PtrBlock
+                   << ", cp::Buffer instance: " << this << std::endl;
+        }
+    }
+
+    m_PtrBlock = NULL;
 }
 
 
@@ -339,26 +532,74 @@ Buffer &Buffer::operator=(Buffer const &rhs)
         return *this;
     }
 
-    size_t size = rhs.m_DataLen;
+    // an empty source leaves no block, as a copy of no data always has
+    if ((rhs.m_DataLen == 0) || (rhs.Storage() == NULL))
+    {
+        Resize(0);
+        return *this;
+    }
 
-    // acquire a buffer of sufficient size
-    if (Resize(size) == false)
+    // already sharing the same block
+    if ((m_PtrBlock != NULL) && (m_PtrBlock == rhs.m_PtrBlock))
     {
-        LogErr << "Buffer::operator=(Buffer): Failed to resize Buffer to size: "
-               << size << ", cp::Buffer instance: " << this << std::endl;
+        m_DataLen = rhs.m_DataLen;
+        return *this;
     }
-    else
+
+    // small data is copied inline, and region blocks vanish with their
+    // region, so neither is shared
+    if ((rhs.m_DataLen <= k_InlineSize) || rhs.m_PtrBlock->Regional())
     {
-        if ((size > 0) && rhs.m_PtrBlock && (rhs.m_PtrBlock->SizeGet() >= size))
+        size_t size = rhs.m_DataLen;
+
+        if (Resize(size) == false)
+        {
+            LogErr << "Buffer::operator=(Buffer): Failed to resize Buffer to size: "
+                   << size << ", cp::Buffer instance: " << this << std::endl;
+        }
+        else
         {
-            // copy the buffer data
-            memcpy(m_PtrBlock->BuffGet(), rhs.m_PtrBlock->BuffGet(), size);
+            memcpy(Storage(), rhs.Storage(), size);
+            m_DataLen = size;
         }
 
-        // copy the data length
-        m_DataLen = size;
+        return *this;
+    }
+
+    // share the source block instead of copying it
+    BlockRelease();
+    rhs.m_PtrBlock->RefInc();
+    m_PtrBlock = rhs.m_PtrBlock;
+    m_DataLen = rhs.m_DataLen;
+
+    return *this;
+}
+
+
+// move assignment operator -- takes the memory block
+Buffer &Buffer::operator=(Buffer &&rhs)
+{
+    // avoid self-assignment
+    if (this == &rhs)
+    {
+        return *this;
     }
 
+    BlockRelease();
+
+    // inline data is copied, a memory block is taken
+    if (rhs.m_Local)
+    {
+        memcpy(m_Inline, rhs.m_Inline, k_InlineSize);
+        m_Local = true;
+    }
+
+    m_PtrBlock = rhs.m_PtrBlock;
+    m_DataLen = rhs.m_DataLen;
+    rhs.m_PtrBlock = NULL;
+    rhs.m_DataLen = 0;
+    rhs.m_Local = false;
+
     return *this;
 }
 
@@ -409,7 +650,7 @@ Buffer &Buffer::operator=(char const *rhs)
         if (size > 0)
         {
             // copy the buffer data (strcpy() copies the terminating zero)
-            strcpy(m_PtrBlock->BuffGet(), rhs);
+            strcpy(Storage(), rhs);
         }
 
         // copy the data length
@@ -432,9 +673,12 @@ Buffer::operator uint32_t *()
 {
     uint32_t *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<uint32_t *>(m_PtrBlock->BuffGet());
+        rv = reinterpret_cast<uint32_t *>(Storage());
     }
 
     return rv;
@@ -446,9 +690,12 @@ Buffer::operator uint16_t *()
 {
     uint16_t *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<uint16_t *>(m_PtrBlock->BuffGet());
+        rv = reinterpret_cast<uint16_t *>(Storage());
     }
 
     return rv;
@@ -460,9 +707,12 @@ Buffer::operator uint8_t *()
 {
     uint8_t *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<uint8_t *>(m_PtrBlock->BuffGet());
+        rv = reinterpret_cast<uint8_t *>(Storage());
     }
 
     return rv;
@@ -474,9 +724,12 @@ Buffer::operator char *()
 {
     char *rv = NULL;
 
-    if (m_PtrBlock != NULL)
+    // the caller may write through the pointer
+    Unshare();
+
+    if (Storage() != NULL)
     {
-        rv = reinterpret_cast<char *>(m_PtrBlock->BuffGet());
+        rv = reinterpret_cast<char *>(Storage());
     }
 
     return rv;
@@ -486,14 +739,52 @@ Buffer::operator char *()
 // convert instance to buffer size
 Buffer::operator size_t()
 {
-    size_t rv = 0;
+    return Size();
+}
+
+
+// return the memory buffer in use, if any
+char *Buffer::Storage() const
+{
+    char *rv = NULL;
 
     if (m_PtrBlock != NULL)
     {
-        rv = m_PtrBlock->SizeGet();
+        rv = m_PtrBlock->BuffGet();
+    }
+    else if (m_Local)
+    {
+        rv = const_cast<char *>(m_Inline);
     }
 
     return rv;
 }
 
+
+// move the data into a new memory block
+// (the space beyond the data is not cleared)
+bool Buffer::Relocate(size_t NewSize)
+{
+    MemBlock *pBlock = NULL;
+
+    if (MemManager::InstanceGet()->MemBlockGet(pBlock, NewSize) == false)
+    {
+        LogErr << "Buffer::Relocate(): Failed to acquire a MemBlock of size: "
+               << NewSize << ", cp::Buffer instance: " << this << std::endl;
+        return false;
+    }
+
+    pBlock->RefSet(1);
+
+    if (Storage() != NULL)
+    {
+        memcpy(pBlock->BuffGet(), Storage(), m_DataLen);
+        BlockRelease();
+    }
+
+    m_PtrBlock = pBlock;
+
+    return true;
+}
+
 }   // namespace cp
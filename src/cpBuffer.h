@@ -16,12 +16,18 @@
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2012-08-31  asc Added copy constructors to match conversion assignment operators.
 //  2022-05-10  asc Added list and vector containers for Buffer.
+//  2026-10-16  asc Made copies share the memory block until one of them is written.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Allowed a BufferView to pin the memory block.
+//  2026-10-16  asc Added content-preserving growth and resize without zero fill.
+//  2026-10-16  asc Held small payloads inline instead of in a memory block.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_BUFFER_H
 #define CP_BUFFER_H
 
 #include "cpString.h"
+#include "cpBufferView.h"
 
 namespace cp
 {
@@ -31,14 +37,32 @@ class StreamBase;
 
 // ----------------------------------------------------------------------------
 
+// Copies of a Buffer share its memory block through the block's reference
+// count.  A Buffer makes a private copy of the block the first time it is
+// written while shared, which includes any call to a non-const pointer
+// accessor.  Code that only reads should use the const accessors.
+//
+// Resize() discards the contents and, unless asked not to, zero fills the new
+// block; receive paths that overwrite the memory should skip the fill.
+// Reserve() and Append() keep the contents, growing in place when the block
+// already has room, in the manner of std::vector::reserve() and push_back().
+//
+// Payloads of up to k_InlineSize octets are held in the Buffer object itself
+// and never touch the memory manager.  Larger ones spill to a memory block.
+// Inline data is copied rather than shared and cannot be pinned in place.
+
 class Buffer
 {
 public:
+    // largest payload held inline
+    enum Constants { k_InlineSize = 32 };
+
     // constructor
     Buffer(size_t Size = 0);
 
     // copy constructors
     Buffer(Buffer const &rhs);
+    Buffer(Buffer &&rhs);
     Buffer(StreamBase &rhs);
     Buffer(String const &rhs);
     Buffer(char const *rhs);
@@ -48,13 +72,16 @@ public:
     ~Buffer();
 
     // accessors
-    bool IsValid()                                          // determine if a memory block is present
+    bool IsValid()                                          // determine if a memory buffer is present
     {
-        return (m_PtrBlock != NULL);
+        return ((m_PtrBlock != NULL) || m_Local);
     }
 
+    bool IsShared() const;                                  // determine if the memory block is shared
+
     size_t LenGet() const;                                  // return the data length
     size_t Size() const;                                    // return the memory buffer size
+    size_t Capacity() const { return Size(); }              // return the memory buffer size
     uint32_t Crc32Get();                                    // calculate the CRC-32 of the buffer contents
     char *c_str(size_t Offset = 0);                         // return a pointer to the memory buffer
     char const *c_str(size_t Offset = 0) const;             // return a pointer to the memory buffer
@@ -65,14 +92,18 @@ public:
     // manipulators
     void Clear(int Val = 0);                                // zero or fill the memory buffer
     void LenSet(size_t Len);                                // set the data length
-    bool Resize(size_t NewSize);                            // acquire a new memory block
+    bool Resize(size_t NewSize, bool ZeroFill = true);      // acquire a new memory block
+    bool Reserve(size_t NewSize);                           // grow the memory block, keeping the contents
+    bool Append(uint8_t const *pBuf, size_t Len);           // append data, growing the memory block as needed
     bool CopyIn(uint8_t const *pBuf, size_t Len);           // copy data into the buffer
     void XferMemBlk(Buffer &Dest);                          // move memory block to destination Buffer
     MemBlock *GetMemBlk();                                  // extract memory block from Buffer
     void SetMemBlk(MemBlock *pBlock);                       // insert memory block into Buffer
+    bool Unshare();                                         // make a private copy of a shared memory block
 
     // operators
     Buffer &operator=(Buffer const &rhs);                   // assignment operator -- any binary content
+    Buffer &operator=(Buffer &&rhs);                        // move assignment operator -- takes the memory block
     Buffer &operator=(StreamBase &rhs);                     // assignment conversion operator -- any binary content
     Buffer &operator=(String const &rhs);                   // assignment conversion operator -- terminated strings only
     Buffer &operator=(char const *rhs);                     // assignment conversion operator -- terminated strings only
@@ -86,8 +117,16 @@ public:
     operator size_t();                                      // convert instance to buffer size
 
 private:
+    friend class BufferView;                                // pins the memory block
+
+    char *Storage() const;                                  // return the memory buffer in use, if any
+    bool Relocate(size_t NewSize);                          // move the data into a new memory block
+    void BlockRelease();                                    // give up the memory block or inline storage
+
     MemBlock           *m_PtrBlock;                         // pointer to managed memory block
     size_t              m_DataLen;                          // length of buffer used
+    bool                m_Local;                            // true when the inline storage is in use
+    alignas(uint64_t) char m_Inline[k_InlineSize];          // inline storage for small payloads
 };
 
 
@@ -0,0 +1,212 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpBufferView.cpp
+//
+//  Description:    Non-owning view of a range of octets.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Pinned inline Buffer data by copying it to a memory block.
+// ----------------------------------------------------------------------------
+
+#include "cpBufferView.h"
+#include "cpBuffer.h"
+#include "cpMemMgr.h"
+#include "cpUtil.h"
+
+namespace cp
+{
+
+// constructor
+BufferView::BufferView() :
+    m_PtrData(NULL),
+    m_Len(0),
+    m_PtrPin(NULL)
+{
+}
+
+
+// constructor
+BufferView::BufferView(char const *pData, size_t Len) :
+    m_PtrData(pData),
+    m_Len(pData ? Len : 0),
+    m_PtrPin(NULL)
+{
+}
+
+
+// constructor
+BufferView::BufferView(uint8_t const *pData, size_t Len) :
+    m_PtrData(reinterpret_cast<char const *>(pData)),
+    m_Len(pData ? Len : 0),
+    m_PtrPin(NULL)
+{
+}
+
+
+// constructor
+BufferView::BufferView(Buffer const &Buf, bool Pin) :
+    m_PtrData(Buf.c_str()),
+    m_Len(Buf.c_str() ? Buf.LenGet() : 0),
+    m_PtrPin(NULL)
+{
+    if (Pin && (Buf.m_PtrBlock != NULL) && (Buf.m_PtrBlock->Regional() == false))
+    {
+        PinSet(Buf.m_PtrBlock);
+    }
+    else if (Pin && Buf.m_Local)
+    {
+        MemBlock *pBlock = NULL;
+
+        // inline data lives in the Buffer object, so view a private copy
+        if (MemManager::InstanceGet()->MemBlockGet(pBlock, Buffer::k_InlineSize))
+        {
+            memcpy(pBlock->BuffGet(), m_PtrData, m_Len);
+            pBlock->RefSet(1);
+            m_PtrPin = pBlock;
+            m_PtrData = pBlock->BuffGet();
+        }
+        else
+        {
+            LogErr << "BufferView::BufferView(): Failed to acquire a MemBlock of size: "
+                   << Buffer::k_InlineSize << ", cp::BufferView instance: " << this << std::endl;
+        }
+    }
+}
+
+
+// copy constructor
+BufferView::BufferView(BufferView const &rhs) :
+    m_PtrData(rhs.m_PtrData),
+    m_Len(rhs.m_Len),
+    m_PtrPin(NULL)
+{
+    PinSet(rhs.m_PtrPin);
+}
+
+
+// move constructor
+BufferView::BufferView(BufferView &&rhs) :
+    m_PtrData(rhs.m_PtrData),
+    m_Len(rhs.m_Len),
+    m_PtrPin(rhs.m_PtrPin)
+{
+    rhs.m_PtrData = NULL;
+    rhs.m_Len = 0;
+    rhs.m_PtrPin = NULL;
+}
+
+
+// destructor
+BufferView::~BufferView()
+{
+    Clear();
+}
+
+
+// return a view of a sub-range
+BufferView BufferView::Slice(size_t Offset, size_t Len) const
+{
+    BufferView view(*this);
+
+    // clip the range to the data in view
+    if (Offset > m_Len)
+    {
+        Offset = m_Len;
+    }
+
+    if (Len > (m_Len - Offset))
+    {
+        Len = m_Len - Offset;
+    }
+
+    view.m_PtrData = c_str(Offset);
+    view.m_Len = Len;
+
+    return view;
+}
+
+
+// calculate the CRC-32 of the data
+uint32_t BufferView::Crc32Get() const
+{
+    return cp::CalcCrc32(m_PtrData, m_Len);
+}
+
+
+// release any pin and view nothing
+void BufferView::Clear()
+{
+    // the last owner of a pinned block returns it
+    if ((m_PtrPin != NULL) && (m_PtrPin->RefDec() == 0))
+    {
+        if (MemManager::InstanceGet()->MemBlockPut(m_PtrPin) == false)
+        {
+            LogErr << "BufferView::Clear(): Failed to return a MemBlock of size: "
+                   << m_PtrPin->SizeGet() << ", block address: " << m_PtrPin
+                   << ", cp::BufferView instance: " << this << std::endl;
+        }
+    }
+
+    m_PtrData = NULL;
+    m_Len = 0;
+    m_PtrPin = NULL;
+}
+
+
+// assignment operator
+BufferView &BufferView::operator=(BufferView const &rhs)
+{
+    // check for self assignment
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    // pin the new block before releasing the old one, which may be the same block
+    BufferView view(rhs);
+
+    return (*this = std::move(view));
+}
+
+
+// move assignment operator -- takes the pin
+BufferView &BufferView::operator=(BufferView &&rhs)
+{
+    // check for self assignment
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    Clear();
+
+    m_PtrData = rhs.m_PtrData;
+    m_Len = rhs.m_Len;
+    m_PtrPin = rhs.m_PtrPin;
+    rhs.m_PtrData = NULL;
+    rhs.m_Len = 0;
+    rhs.m_PtrPin = NULL;
+
+    return *this;
+}
+
+
+// take an owner reference on a block
+void BufferView::PinSet(MemBlock *pBlock)
+{
+    if (pBlock != NULL)
+    {
+        pBlock->RefInc();
+        m_PtrPin = pBlock;
+    }
+}
+
+}   // namespace cp
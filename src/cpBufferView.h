@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpBufferView.h
+//
+//  Description:    Non-owning view of a range of octets.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Pinned inline Buffer data by copying it to a memory block.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_BUFFERVIEW_H
+#define CP_BUFFERVIEW_H
+
+#include "cpPlatform.h"
+
+namespace cp
+{
+
+class Buffer;
+class MemBlock;
+
+// ----------------------------------------------------------------------------
+
+// A BufferView refers to a range of octets owned by something else, such as
+// a Buffer, an IpcSegment payload or a stream block, so that read-only code
+// can inspect the data without copying it into a Buffer of its own.
+//
+// A plain view is only valid while its source is alive and unmodified.  A
+// view made from a Buffer may instead pin the Buffer's memory block by taking
+// an owner reference on it; the viewed octets then stay intact after the
+// Buffer is written (the Buffer copies on write) or destroyed.  Small data a
+// Buffer holds inline has no block, so pinning it copies it to a new block.
+// Blocks carved from a MemRegion cannot be pinned and live only as long as
+// their region.
+
+class BufferView
+{
+public:
+    // constructor
+    BufferView();
+    BufferView(char const *pData, size_t Len);
+    BufferView(uint8_t const *pData, size_t Len);
+    BufferView(Buffer const &Buf, bool Pin = false);
+
+    // copy constructor
+    BufferView(BufferView const &rhs);
+
+    // move constructor
+    BufferView(BufferView &&rhs);
+
+    // destructor
+    ~BufferView();
+
+    // accessors
+    size_t LenGet() const { return m_Len; }                 // return the data length
+    bool IsEmpty() const { return (m_Len == 0); }           // determine if the view has no data
+    bool IsPinned() const { return (m_PtrPin != NULL); }    // determine if a memory block is pinned
+    char const *c_str(size_t Offset = 0) const              // return a pointer to the data
+        { return m_PtrData ? (m_PtrData + Offset) : NULL; }
+    uint8_t const *u_str(size_t Offset = 0) const           // return a pointer to the data
+        { return reinterpret_cast<uint8_t const *>(c_str(Offset)); }
+    BufferView Slice(size_t Offset, size_t Len) const;      // return a view of a sub-range
+    uint32_t Crc32Get() const;                              // calculate the CRC-32 of the data
+
+    // manipulators
+    void Clear();                                           // release any pin and view nothing
+
+    // operators
+    BufferView &operator=(BufferView const &rhs);           // assignment operator
+    BufferView &operator=(BufferView &&rhs);                // move assignment operator -- takes the pin
+    uint8_t operator[](size_t Index) const                  // return an octet by index position
+        { return static_cast<uint8_t>(m_PtrData[Index]); }
+
+private:
+    void PinSet(MemBlock *pBlock);                          // take an owner reference on a block
+
+    char const         *m_PtrData;                          // first octet in view
+    size_t              m_Len;                              // number of octets in view
+    MemBlock           *m_PtrPin;                           // pinned memory block, if any
+};
+
+}   // namespace cp
+
+#endif  // CP_BUFFERVIEW_H
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpChecksum.cpp
+//
+//  Description:    Checksum Algorithm Registry.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#include "cpChecksum.h"
+#include "cpDatum.h"
+#include "cpMemRegion.h"
+#include "cpStreamBase.h"
+
+namespace cp
+{
+
+// singleton instance
+ChecksumRegistry *ChecksumRegistry::m_PtrInstance = NULL;
+
+// calculate the CRC-16 of a stream
+static uint64_t ChecksumCrc16(StreamBase &Stream, size_t Len)
+{
+    return Stream.Crc16Get(Len);
+}
+
+
+// calculate the CRC-32 of a stream
+static uint64_t ChecksumCrc32(StreamBase &Stream, size_t Len)
+{
+    return Stream.Crc32Get(Len);
+}
+
+
+// calculate the 64-bit hash of a stream
+static uint64_t ChecksumHash64(StreamBase &Stream, size_t Len)
+{
+    return Stream.Hash64Get(Len);
+}
+
+// ----------------------------------------------------------------------------
+
+// constructor
+ChecksumRegistry::ChecksumRegistry() :
+    m_Mutex("Checksum Registry Mutex")
+{
+    for (size_t i = 0; i < k_MaxModes; ++i)
+    {
+        m_Algs[i].m_PtrFunc = NULL;
+        m_Algs[i].m_Size = 0;
+    }
+
+    // register the intrinsic algorithms
+    Register(Datum::ck_Crc16, ChecksumCrc16, sizeof(uint16_t));
+    Register(Datum::ck_Crc32, ChecksumCrc32, sizeof(uint32_t));
+    Register(Datum::ck_Hash64, ChecksumHash64, sizeof(uint64_t));
+}
+
+
+// destructor
+ChecksumRegistry::~ChecksumRegistry()
+{
+}
+
+
+// singleton instance get method
+ChecksumRegistry *ChecksumRegistry::InstanceGet()
+{
+    if (m_PtrInstance == NULL)
+    {
+        // the registry outlives any region bound to the calling thread
+        MemRegion::Suspend suspend;
+        m_PtrInstance = new (CP_NEW) ChecksumRegistry;
+    }
+
+    if (m_PtrInstance == NULL)
+    {
+        LogErr << "ChecksumRegistry::InstanceGet(): Failed to create ChecksumRegistry instance."
+               << std::endl;
+    }
+
+    return m_PtrInstance;
+}
+
+
+// look up the algorithm for a mode
+bool ChecksumRegistry::Find(uint8_t Mode, Algorithm &Alg)
+{
+    m_Mutex.Lock();
+    Alg = m_Algs[Mode];
+    m_Mutex.Unlock();
+
+    return (Alg.m_PtrFunc != NULL);
+}
+
+
+// set the algorithm for a mode (a NULL function removes it)
+bool ChecksumRegistry::Register(uint8_t Mode, ChecksumFunc_t pFunc, size_t Size)
+{
+    // the encoded checksum must fit in the value the function returns
+    if ((Mode == Datum::ck_None) || ((pFunc != NULL) && ((Size == 0) || (Size > k_MaxSize))))
+    {
+        LogErr << "ChecksumRegistry::Register(): Invalid checksum mode: " << uint32_t(Mode)
+               << " or size: " << Size << std::endl;
+        return false;
+    }
+
+    m_Mutex.Lock();
+    m_Algs[Mode].m_PtrFunc = pFunc;
+    m_Algs[Mode].m_Size = pFunc ? Size : 0;
+    m_Mutex.Unlock();
+
+    return true;
+}
+
+}   // namespace cp
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpChecksum.h
+//
+//  Description:    Checksum Algorithm Registry.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_CHECKSUM_H
+#define CP_CHECKSUM_H
+
+#include "cpMutex.h"
+
+namespace cp
+{
+
+class StreamBase;
+
+// calculates a checksum over the leading octets of a stream
+typedef uint64_t (*ChecksumFunc_t)(StreamBase &Stream, size_t Len);
+
+// ----------------------------------------------------------------------------
+
+// The registry maps each Datum::CheckSum_t mode to the function that
+// calculates it and the number of octets the result occupies when encoded,
+// so serializers handle every mode the same way.  The CRC-16, CRC-32 and
+// 64-bit hash modes are registered on creation; other modes, including the
+// cryptographic digests, may be registered by the application.
+
+class ChecksumRegistry
+{
+public:
+    // checksum algorithm
+    struct Algorithm
+    {
+        ChecksumFunc_t  m_PtrFunc;                          // calculation function
+        size_t          m_Size;                             // octets in the encoded checksum
+    };
+
+    // constants
+    enum Constants { k_MaxModes = 256, k_MaxSize = sizeof(uint64_t) };
+
+    // destructor
+    ~ChecksumRegistry();
+
+    // singleton instance get method
+    static ChecksumRegistry *InstanceGet();
+
+    // accessors
+    bool Find(uint8_t Mode, Algorithm &Alg);                // look up the algorithm for a mode
+
+    // manipulators
+    bool Register(uint8_t Mode, ChecksumFunc_t pFunc,
+                  size_t Size);                             // set the algorithm for a mode
+
+private:
+    // constructor
+    ChecksumRegistry();
+
+    Mutex                   m_Mutex;                        // thread protection mutex
+    Algorithm               m_Algs[k_MaxModes];             // algorithm for each mode
+    static ChecksumRegistry *m_PtrInstance;                 // singleton instance
+};
+
+}   // namespace cp
+
+#endif  // CP_CHECKSUM_H
@@ -13,6 +13,7 @@
 //
 //  History:
 //  2012-08-10  asc Creation.
+//  2026-10-16  asc Added memory region sentinel.
 // ----------------------------------------------------------------------------
 
 #include "cpPlatform.h"
@@ -32,6 +33,7 @@ size_t const k_MinStreamBlockSize = 256;
 size_t const k_DefaultThreadStack = 16384;
 size_t const k_UdpMaxMsgLen = 1400;
 uint16_t const k_MemSentinel = 0x1a19;
+uint16_t const k_RegionSentinel = 0x1a1b;
 uint32_t const k_DefaultThreadPriority = 16;
 uint32_t const k_MinimumThreadPriority = 31;
 
@@ -13,6 +13,7 @@
 //
 //  History:
 //  2012-08-10  asc Creation.
+//  2026-10-16  asc Added memory region sentinel.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_CONSTANTS_H
@@ -33,6 +34,7 @@ extern size_t const k_MinStreamBlockSize;
 extern size_t const k_DefaultThreadStack;
 extern size_t const k_UdpMaxMsgLen;
 extern uint16_t const k_MemSentinel;
+extern uint16_t const k_RegionSentinel;
 extern uint32_t const k_DefaultThreadPriority;
 extern uint32_t const k_MinimumThreadPriority;
 
@@ -0,0 +1,382 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpCrc.cpp
+//
+//  Description:    CRC Calculation Engine.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added CRC-32 combination and parallel calculation.
+//  2026-10-16  asc Added table driven CRC-16.
+// ----------------------------------------------------------------------------
+
+#include "cpCrc.h"
+#include "cpSimd.h"
+#include "cpThread.h"
+
+namespace cp
+{
+
+// reflected CRC-32 generator polynomial
+static uint32_t const k_Crc32Poly = 0xedb88320;
+
+// least work worth handing to a thread of its own
+static size_t const k_Crc32ShareMin = 1024 * 1024;
+
+// one thread's share of a parallel CRC-32
+struct Crc32Share
+{
+    BufferViewVec_t     m_Views;                            // octets to process
+    size_t              m_Len;                              // number of octets to process
+    uint32_t            m_Crc;                              // remainder of the octets from zero
+};
+
+// slicing-by-8 lookup tables for the reflected CRC-32
+class Crc32Tables
+{
+public:
+    // constructor
+    Crc32Tables()
+    {
+        uint32_t gen = k_Crc32Poly;
+
+        // table 0 is the remainder of each single octet
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t rem = i;
+
+            for (size_t bit = 0; bit < 8; ++bit)
+            {
+                rem = (rem & 1) ? ((rem >> 1) ^ gen) : (rem >> 1);
+            }
+
+            tab[0][i] = rem;
+        }
+
+        // table k advances table k-1 by one more zero octet
+        for (size_t k = 1; k < 8; ++k)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                tab[k][i] = (tab[k - 1][i] >> 8) ^ tab[0][tab[k - 1][i] & 0xff];
+            }
+        }
+    }
+
+    uint32_t tab[8][256];       // remainder of an octet followed by k zero octets
+};
+
+
+// slicing-by-8 lookup tables for the CRC-16
+class Crc16Tables
+{
+public:
+    // constructor
+    Crc16Tables()
+    {
+        uint16_t gen = 0x1021;
+
+        // table 0 is the remainder of each single octet
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint16_t rem = uint16_t(i << 8);
+
+            for (size_t bit = 0; bit < 8; ++bit)
+            {
+                rem = (rem & 0x8000) ? uint16_t((rem << 1) ^ gen) : uint16_t(rem << 1);
+            }
+
+            tab[0][i] = rem;
+        }
+
+        // table k advances table k-1 by one more zero octet
+        for (size_t k = 1; k < 8; ++k)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                tab[k][i] = uint16_t(tab[k - 1][i] << 8) ^ tab[0][tab[k - 1][i] >> 8];
+            }
+        }
+    }
+
+    uint16_t tab[8][256];       // remainder of an octet followed by k zero octets
+};
+
+
+// return the CRC-16 tables, built on first use
+static Crc16Tables const &Crc16TablesGet()
+{
+    static Crc16Tables const tables;
+
+    return tables;
+}
+
+
+// return the tables, built on first use
+static Crc32Tables const &Crc32TablesGet()
+{
+    static Crc32Tables const tables;
+
+    return tables;
+}
+
+
+// update a reflected CRC-32 remainder using slicing-by-8 tables
+static uint32_t Crc32Slice8(uint32_t Crc, uint8_t const *pBuf, size_t Size)
+{
+    uint32_t const (*tab)[256] = Crc32TablesGet().tab;
+
+    // eight octets per step, assembled little endian regardless of the host
+    while (Size >= 8)
+    {
+        uint32_t lo = Crc ^ (uint32_t(pBuf[0]) | (uint32_t(pBuf[1]) << 8) |
+                             (uint32_t(pBuf[2]) << 16) | (uint32_t(pBuf[3]) << 24));
+        uint32_t hi = uint32_t(pBuf[4]) | (uint32_t(pBuf[5]) << 8) |
+                      (uint32_t(pBuf[6]) << 16) | (uint32_t(pBuf[7]) << 24);
+
+        Crc = tab[7][lo & 0xff] ^ tab[6][(lo >> 8) & 0xff] ^
+              tab[5][(lo >> 16) & 0xff] ^ tab[4][lo >> 24] ^
+              tab[3][hi & 0xff] ^ tab[2][(hi >> 8) & 0xff] ^
+              tab[1][(hi >> 16) & 0xff] ^ tab[0][hi >> 24];
+
+        pBuf += 8;
+        Size -= 8;
+    }
+
+    // then one octet at a time
+    while (Size > 0)
+    {
+        Crc = (Crc >> 8) ^ tab[0][(Crc ^ *pBuf) & 0xff];
+        ++pBuf;
+        --Size;
+    }
+
+    return Crc;
+}
+
+
+// update a CRC-16 remainder with a block of data
+uint16_t Crc16Update(uint16_t Crc, uint8_t const *pBuf, size_t Size)
+{
+    uint16_t const (*tab)[256] = Crc16TablesGet().tab;
+
+    // eight octets per step, the remainder overlapping the first two
+    while (Size >= 8)
+    {
+        Crc = tab[7][pBuf[0] ^ (Crc >> 8)] ^ tab[6][pBuf[1] ^ (Crc & 0xff)] ^
+              tab[5][pBuf[2]] ^ tab[4][pBuf[3]] ^
+              tab[3][pBuf[4]] ^ tab[2][pBuf[5]] ^
+              tab[1][pBuf[6]] ^ tab[0][pBuf[7]];
+
+        pBuf += 8;
+        Size -= 8;
+    }
+
+    // then one octet at a time
+    while (Size > 0)
+    {
+        Crc = uint16_t(Crc << 8) ^ tab[0][(Crc >> 8) ^ *pBuf];
+        ++pBuf;
+        --Size;
+    }
+
+    return Crc;
+}
+
+
+// update a reflected CRC-32 remainder with a block of data
+uint32_t Crc32Update(uint32_t Crc, uint8_t const *pBuf, size_t Size)
+{
+#if defined(CP_SIMD_X86)
+    // fold whole 16 octet units when the run is long enough to pay off
+    if ((Size >= 64) && CpuPclmul())
+    {
+        size_t len = Size & ~size_t(15);
+
+        Crc = Crc32Pclmul(Crc, pBuf, len);
+        pBuf += len;
+        Size -= len;
+    }
+#endif
+
+    return Crc32Slice8(Crc, pBuf, Size);
+}
+
+
+// multiply two reflected polynomials modulo the generator
+static uint32_t Crc32MultMod(uint32_t A, uint32_t B)
+{
+    uint32_t mask = 0x80000000;     // x^0 in reflected order
+    uint32_t product = 0;
+
+    while (mask != 0)
+    {
+        if (A & mask)
+        {
+            product ^= B;
+        }
+
+        mask >>= 1;
+        B = (B & 1) ? ((B >> 1) ^ k_Crc32Poly) : (B >> 1);
+    }
+
+    return product;
+}
+
+
+// advance a reflected CRC-32 remainder over Len zero octets
+uint32_t Crc32Shift(uint32_t Crc, size_t Len)
+{
+    uint32_t power = 0x00800000;    // x^8, one zero octet
+    uint64_t bits = Len;
+
+    // multiply by x^(8 * Len), squaring the power of x for each bit of Len
+    while (bits != 0)
+    {
+        if (bits & 1)
+        {
+            Crc = Crc32MultMod(power, Crc);
+        }
+
+        power = Crc32MultMod(power, power);
+        bits >>= 1;
+    }
+
+    return Crc;
+}
+
+
+// combine the CRC-32 of one block with the CRC-32 of the Len2 octets that follow
+uint32_t Crc32Combine(uint32_t Crc1, uint32_t Crc2, size_t Len2)
+{
+    // the initial and final inversions of the two values cancel out
+    return Crc32Shift(Crc1, Len2) ^ Crc2;
+}
+
+
+// calculate one share of a parallel CRC-32
+static void Crc32ShareCalc(Crc32Share &Share)
+{
+    Share.m_Crc = 0;
+
+    for (BufferViewVec_t::const_iterator i = Share.m_Views.begin(); i != Share.m_Views.end(); ++i)
+    {
+        Share.m_Crc = Crc32Update(Share.m_Crc, i->u_str(), i->LenGet());
+    }
+}
+
+
+// thread function that calculates one share
+static void *Crc32ShareThread(Thread *pThread)
+{
+    Crc32ShareCalc(*reinterpret_cast<Crc32Share *>(pThread->ContextGet()));
+
+    return pThread;
+}
+
+
+// update a reflected CRC-32 remainder with a sequence of views
+uint32_t Crc32Parallel(uint32_t Crc, BufferViewVec_t const &Views, size_t Workers)
+{
+    std::vector<Crc32Share, Alloc<Crc32Share> > shares;
+    std::vector<Thread *, Alloc<Thread *> > threads;
+    size_t total = 0;
+    size_t quota = 0;
+
+    for (BufferViewVec_t::const_iterator i = Views.begin(); i != Views.end(); ++i)
+    {
+        total += i->LenGet();
+    }
+
+    // only use as many threads as there is work for
+    if (Workers > (total / k_Crc32ShareMin))
+    {
+        Workers = total / k_Crc32ShareMin;
+    }
+
+    if (Workers <= 1)
+    {
+        for (BufferViewVec_t::const_iterator i = Views.begin(); i != Views.end(); ++i)
+        {
+            Crc = Crc32Update(Crc, i->u_str(), i->LenGet());
+        }
+
+        return Crc;
+    }
+
+    // deal the octets out in order, splitting views where a share fills up
+    quota = (total + Workers - 1) / Workers;
+    shares.resize(Workers);
+
+    for (size_t n = 0; n < Workers; ++n)
+    {
+        shares[n].m_Len = 0;
+        shares[n].m_Crc = 0;
+    }
+
+    size_t cur = 0;
+
+    for (BufferViewVec_t::const_iterator i = Views.begin(); i != Views.end(); ++i)
+    {
+        size_t offset = 0;
+
+        while (offset < i->LenGet())
+        {
+            size_t take = i->LenGet() - offset;
+
+            if ((shares[cur].m_Len == quota) && (cur < (Workers - 1)))
+            {
+                ++cur;
+            }
+
+            if (take > (quota - shares[cur].m_Len))
+            {
+                take = quota - shares[cur].m_Len;
+            }
+
+            shares[cur].m_Views.push_back(i->Slice(offset, take));
+            shares[cur].m_Len += take;
+            offset += take;
+        }
+    }
+
+    // the calling thread takes the first share while the others run
+    for (size_t n = 1; n < Workers; ++n)
+    {
+        threads.push_back(new Thread("Crc32Share", Crc32ShareThread, &shares[n]));
+    }
+
+    Crc32ShareCalc(shares[0]);
+
+    for (size_t n = 0; n < threads.size(); ++n)
+    {
+        // a share whose thread could not start is calculated here instead
+        if (threads[n]->IsValid())
+        {
+            threads[n]->WaitExit(k_InfiniteTimeout);
+        }
+        else
+        {
+            Crc32ShareCalc(shares[n + 1]);
+        }
+
+        delete threads[n];
+    }
+
+    // join the shares onto the starting remainder
+    for (size_t n = 0; n < Workers; ++n)
+    {
+        Crc = Crc32Shift(Crc, shares[n].m_Len) ^ shares[n].m_Crc;
+    }
+
+    return Crc;
+}
+
+}   // namespace cp
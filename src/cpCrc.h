@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpCrc.h
+//
+//  Description:    CRC Calculation Engine.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added CRC-32 combination and parallel calculation.
+//  2026-10-16  asc Added table driven CRC-16.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_CRC_H
+#define CP_CRC_H
+
+#include "cpBufferView.h"
+#include "cpString.h"
+
+// ----------------------------------------------------------------------------
+// The engine works on the raw remainder of the reflected CRC-32 (generator
+// 0x04c11db7, the IEEE 802.3 CRC) without the initial and final inversion,
+// which CalcCrc32() applies.  Runs of 64 octets or more are folded with
+// carry-less multiplication on CPUs that support it; the rest is processed
+// eight octets at a time with slicing-by-8 tables.
+//
+// The remainder is linear in its inputs, so the CRC of concatenated blocks
+// can be formed from the CRCs of the blocks and the lengths that follow
+// them.  That lets separate threads each take a share of a long run.
+//
+// The CRC-16 is the unreflected CCITT polynomial 0x1021, also processed
+// eight octets at a time with slicing-by-8 tables.
+// ----------------------------------------------------------------------------
+
+namespace cp
+{
+
+// local custom types
+typedef std::vector<BufferView, Alloc<BufferView> > BufferViewVec_t;
+
+// update a CRC-16 remainder with a block of data
+uint16_t Crc16Update(uint16_t Crc, uint8_t const *pBuf, size_t Size);
+
+// update a reflected CRC-32 remainder with a block of data
+uint32_t Crc32Update(uint32_t Crc, uint8_t const *pBuf, size_t Size);
+
+// advance a reflected CRC-32 remainder over Len zero octets
+uint32_t Crc32Shift(uint32_t Crc, size_t Len);
+
+// combine the CRC-32 of one block with the CRC-32 of the Len2 octets that follow
+// (both as returned by CalcCrc32())
+uint32_t Crc32Combine(uint32_t Crc1, uint32_t Crc2, size_t Len2);
+
+// update a reflected CRC-32 remainder with a sequence of views, sharing the
+// work among up to Workers threads when there is enough of it
+uint32_t Crc32Parallel(uint32_t Crc, BufferViewVec_t const &Views, size_t Workers);
+
+}   // namespace cp
+
+#endif  // CP_CRC_H
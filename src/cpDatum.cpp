@@ -24,6 +24,9 @@
 //  2013-07-17  asc Added Inert() static accessor method.
 //  2013-07-19  asc Reverted inert to a member boolean.
 //  2025-01-02  asc Fixed compilter update issue with Find() const.
+//  2026-10-16  asc Constructed sub-datums and attributes in place.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Tracked the stream CRC-32 while encoding with a CRC-32 check.
 // ----------------------------------------------------------------------------
 
 #include "cpDatum.h"
@@ -72,6 +75,14 @@ Datum::Datum(Datum const &rhs) :
 }
 
 
+// move constructor
+Datum::Datum(Datum &&rhs) :
+    m_Inert(false)
+{
+    *this = std::move(rhs);
+}
+
+
 // destructor
 Datum::~Datum()
 {
@@ -380,6 +391,38 @@ Datum &Datum::operator=(Datum const &rhs)
 }
 
 
+// move assignment operator
+Datum &Datum::operator=(Datum &&rhs)
+{
+    // an inert source is shared and must not be emptied
+    if (rhs.Inactive())
+    {
+        return *this = rhs;
+    }
+
+    // detect self-assignment or inert status
+    if ((this == &rhs) || Inactive())
+    {
+        return *this;
+    }
+
+    m_Self      = rhs.m_Self;
+
+    // take the attributes and sub-datums
+    m_Attribs = std::move(rhs.m_Attribs);
+    m_Datums  = std::move(rhs.m_Datums);
+
+    // leave the source empty
+    rhs.m_Attribs.clear();
+    rhs.m_Datums.clear();
+    rhs.Rewind();
+
+    Rewind();
+
+    return *this;
+}
+
+
 // returns reference to a subdatum by index position
 Datum &Datum::operator[](uint32_t Index)
 {
@@ -632,7 +675,17 @@ void Datum::AttrSet(Attrib_t Type, Variant const &Var)
 {
     if (IsActive())
     {
-        m_Attribs[Type] = Var;
+        m_Attribs.insert_or_assign(Type, Var);
+    }
+}
+
+
+// set an attribute from a temporary
+void Datum::AttrSet(Attrib_t Type, Variant &&Var)
+{
+    if (IsActive())
+    {
+        m_Attribs.insert_or_assign(Type, std::move(Var));
     }
 }
 
@@ -775,6 +828,7 @@ bool Datum::Encode(Buffer &Buf, String const &Enc, CheckSum_t ChkMode)
 bool Datum::Encode(StreamBase &Stream, String const &Enc, CheckSum_t ChkMode)
 {
     bool rv = true;
+    bool track = Stream.Crc32Tracking();
     SerDes *pSerDes = NULL;
 
     // do nothing if inert
@@ -794,11 +848,19 @@ bool Datum::Encode(StreamBase &Stream, String const &Enc, CheckSum_t ChkMode)
         return false;
     }
 
+    // fold the CRC-32 in as the stream fills so the check is ready on close
+    if (ChkMode == ck_Crc32)
+    {
+        Stream.Crc32Track(true);
+    }
+
     // serialize to the stream
     rv = rv && pSerDes->Open(Stream, DatumVersion());
     rv = rv && Encode(pSerDes);
     rv = rv && pSerDes->Close(ChkMode);
 
+    Stream.Crc32Track(track);
+
     // return serializer
     SerDesFactory::InstanceGet()->SerDesPut(pSerDes);
 
@@ -922,7 +984,25 @@ Datum &Datum::Add()
 // adds a named datum to the collection
 Datum &Datum::Add(String const &Name)
 {
-    return Add(Datum(Name));
+    // do nothing if inert
+    if (Inactive())
+    {
+        return g_InertDatum;
+    }
+
+    Data_t::iterator i = Find(Name);
+
+    // if it already exists just reset it otherwise construct it in place
+    if ((i != m_Datums.end()) && (Name.length() > 0))
+    {
+        *i = Datum(Name);
+    }
+    else
+    {
+        i = m_Datums.emplace(m_Datums.end(), Name);
+    }
+
+    return Current(i);
 }
 
 
@@ -935,31 +1015,56 @@ Datum &Datum::Add(Datum const &rhs)
         return g_InertDatum;
     }
 
-    Data_t::iterator i = Find(rhs.NameGet());
+    String name = rhs.NameGet();
+    Data_t::iterator i = Find(name);
 
     // if it already exists just assign the new value otherwise add it to the collection
-    if ((i != m_Datums.end()) && (rhs.NameGet().length() > 0))
+    if ((i != m_Datums.end()) && (name.length() > 0))
     {
         *i = rhs;
     }
     else
     {
-        m_Datums.push_back(rhs);
+        i = m_Datums.emplace(m_Datums.end(), rhs);
+    }
 
-        i = m_Datums.end();
-        --i;
+    return Current(i);
+}
+
+
+// adds a temporary datum to the collection
+Datum &Datum::Add(Datum &&rhs)
+{
+    // do nothing if inert
+    if (Inactive())
+    {
+        return g_InertDatum;
     }
 
-    // set newly added (or updated) sub-datum to be current
-    m_IterData = i;
-    m_Self = false;
+    String name = rhs.NameGet();
+    Data_t::iterator i = Find(name);
 
-    if (i != m_Datums.end())
+    // if it already exists just assign the new value otherwise move it into the collection
+    if ((i != m_Datums.end()) && (name.length() > 0))
     {
-        return *i;
+        *i = std::move(rhs);
+    }
+    else
+    {
+        i = m_Datums.emplace(m_Datums.end(), std::move(rhs));
     }
 
-    return g_InertDatum;
+    return Current(i);
+}
+
+
+// make a sub-datum current and return it
+Datum &Datum::Current(Data_t::iterator It)
+{
+    m_IterData = It;
+    m_Self = false;
+
+    return *It;
 }
 
 
@@ -23,6 +23,9 @@
 //  2013-06-28  asc Made name and inert attributes instead of a members.
 //  2013-07-17  asc Added Inert() static accessor method.
 //  2013-07-19  asc Reverted inert to a member boolean.
+//  2026-10-16  asc Constructed sub-datums and attributes in place.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Added CRC-16 and 64-bit hash checksum types.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_DATUM_H
@@ -65,7 +68,9 @@ public:
         ck_None,
         ck_Crc32,
         ck_Md5Sum,
-        ck_Sha1Sum
+        ck_Sha1Sum,
+        ck_Crc16,
+        ck_Hash64
     };
 
     // custom data types
@@ -78,6 +83,9 @@ public:
     // copy constructor
     Datum(Datum const &rhs);
 
+    // move constructor
+    Datum(Datum &&rhs);
+
     // destructor
     virtual ~Datum();
 
@@ -113,6 +121,7 @@ public:
 
     // operators
     Datum &operator=(Datum const &rhs);                     // standard assignment operator
+    Datum &operator=(Datum &&rhs);                          // move assignment operator
     Datum &operator[](uint32_t Index);                      // returns reference to a subdatum by index position
     Datum &operator++();                                    // increments to the next virtual datum recursively
     bool operator!();                                       // returns false if current virtual datum is invalid
@@ -145,6 +154,7 @@ public:
     // manipulators
     void NameSet(String const &Name);                       // set the datum name
     void AttrSet(Attrib_t Type, Variant const &Var);        // set an attribute
+    void AttrSet(Attrib_t Type, Variant &&Var);             // set an attribute from a temporary
     void AttrDel(Attrib_t Type);                            // delete an attribute
     Variant &AttrSet(Attrib_t Type);                        // set an attribute
     Variant &ValSet();                                      // set the value attribute
@@ -182,6 +192,7 @@ public:
     Datum &Add();                                           // adds an anonymous datum to the collection
     Datum &Add(String const &Name);                         // adds a named datum to the collection
     Datum &Add(Datum const &rhs);                           // adds an existing datum to the collection
+    Datum &Add(Datum &&rhs);                                // adds a temporary datum to the collection
 
 protected:
 
@@ -193,6 +204,7 @@ protected:
 
     size_t Encode(SerDes *pSerDes);                         // encodes datum and its sub-data recursively
     bool Advance(bool Recurse = false);                     // advance the current datum pointer
+    Datum &Current(Data_t::iterator It);                    // make a sub-datum current and return it
 
     bool                m_Inert;                            // indicates an inert instance that won't allow state change
     bool                m_Self;                             // true to indicate current datum is reference to itself
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpHash.cpp
+//
+//  Description:    Non-Cryptographic Hash Functions.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#include "cpHash.h"
+
+namespace cp
+{
+
+// XXH64 primes
+static uint64_t const k_Prime1 = 0x9e3779b185ebca87ULL;
+static uint64_t const k_Prime2 = 0xc2b2ae3d27d4eb4fULL;
+static uint64_t const k_Prime3 = 0x165667b19e3779f9ULL;
+static uint64_t const k_Prime4 = 0x85ebca77c2b2ae63ULL;
+static uint64_t const k_Prime5 = 0x27d4eb2f165667c5ULL;
+
+// rotate a long long word left
+static inline uint64_t RotL64(uint64_t Val, unsigned Bits)
+{
+    return (Val << Bits) | (Val >> (64 - Bits));
+}
+
+
+// assemble a little endian long long word regardless of the host
+static inline uint64_t Read64(uint8_t const *p)
+{
+    return uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+           (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+}
+
+
+// assemble a little endian long word regardless of the host
+static inline uint32_t Read32(uint8_t const *p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+
+// mix one input word into a lane accumulator
+static inline uint64_t Round(uint64_t Acc, uint64_t Input)
+{
+    return RotL64(Acc + (Input * k_Prime2), 31) * k_Prime1;
+}
+
+
+// merge a lane accumulator into the hash
+static inline uint64_t MergeRound(uint64_t Hash, uint64_t Acc)
+{
+    return ((Hash ^ Round(0, Acc)) * k_Prime1) + k_Prime4;
+}
+
+
+// process whole stripes, returning the number of octets consumed
+static size_t Stripes(uint64_t *pAcc, uint8_t const *pBuf, size_t Size)
+{
+    uint64_t v1 = pAcc[0];
+    uint64_t v2 = pAcc[1];
+    uint64_t v3 = pAcc[2];
+    uint64_t v4 = pAcc[3];
+    size_t done = 0;
+
+    // the four lanes are independent, so they run in parallel in the pipeline
+    while ((Size - done) >= 32)
+    {
+        v1 = Round(v1, Read64(pBuf + done));
+        v2 = Round(v2, Read64(pBuf + done + 8));
+        v3 = Round(v3, Read64(pBuf + done + 16));
+        v4 = Round(v4, Read64(pBuf + done + 24));
+        done += 32;
+    }
+
+    pAcc[0] = v1;
+    pAcc[1] = v2;
+    pAcc[2] = v3;
+    pAcc[3] = v4;
+
+    return done;
+}
+
+// ----------------------------------------------------------------------------
+
+// constructor
+Hash64::Hash64(uint64_t Seed)
+{
+    Reset(Seed);
+}
+
+
+// return the hash of the data so far
+uint64_t Hash64::Final() const
+{
+    uint8_t const *pBuf = m_Stripe;
+    size_t left = m_StripeLen;
+    uint64_t hash = 0;
+
+    if (m_Total >= k_StripeSize)
+    {
+        hash = RotL64(m_Acc[0], 1) + RotL64(m_Acc[1], 7) + RotL64(m_Acc[2], 12) + RotL64(m_Acc[3], 18);
+        hash = MergeRound(hash, m_Acc[0]);
+        hash = MergeRound(hash, m_Acc[1]);
+        hash = MergeRound(hash, m_Acc[2]);
+        hash = MergeRound(hash, m_Acc[3]);
+    }
+    else
+    {
+        hash = m_Seed + k_Prime5;
+    }
+
+    hash += m_Total;
+
+    // fold in the octets short of a whole stripe
+    while (left >= 8)
+    {
+        hash = (RotL64(hash ^ Round(0, Read64(pBuf)), 27) * k_Prime1) + k_Prime4;
+        pBuf += 8;
+        left -= 8;
+    }
+
+    if (left >= 4)
+    {
+        hash = (RotL64(hash ^ (uint64_t(Read32(pBuf)) * k_Prime1), 23) * k_Prime2) + k_Prime3;
+        pBuf += 4;
+        left -= 4;
+    }
+
+    while (left > 0)
+    {
+        hash = RotL64(hash ^ (uint64_t(*pBuf) * k_Prime5), 11) * k_Prime1;
+        ++pBuf;
+        --left;
+    }
+
+    // avalanche
+    hash ^= hash >> 33;
+    hash *= k_Prime2;
+    hash ^= hash >> 29;
+    hash *= k_Prime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+
+// start a new hash
+void Hash64::Reset(uint64_t Seed)
+{
+    m_Seed = Seed;
+    m_Total = 0;
+    m_Acc[0] = Seed + k_Prime1 + k_Prime2;
+    m_Acc[1] = Seed + k_Prime2;
+    m_Acc[2] = Seed;
+    m_Acc[3] = Seed - k_Prime1;
+    m_StripeLen = 0;
+}
+
+
+// add a block of data to the hash
+void Hash64::Update(void const *pBuf, size_t Size)
+{
+    uint8_t const *pSrc = static_cast<uint8_t const *>(pBuf);
+    size_t take = 0;
+
+    if ((pSrc == NULL) || (Size == 0))
+    {
+        return;
+    }
+
+    m_Total += Size;
+
+    // complete a partial stripe left by the previous block
+    if (m_StripeLen > 0)
+    {
+        take = k_StripeSize - m_StripeLen;
+
+        if (take > Size)
+        {
+            take = Size;
+        }
+
+        memcpy(m_Stripe + m_StripeLen, pSrc, take);
+        m_StripeLen += take;
+        pSrc += take;
+        Size -= take;
+
+        if (m_StripeLen < k_StripeSize)
+        {
+            return;
+        }
+
+        Stripes(m_Acc, m_Stripe, k_StripeSize);
+        m_StripeLen = 0;
+    }
+
+    // hash whole stripes in place and keep what is left over
+    take = Stripes(m_Acc, pSrc, Size);
+    m_StripeLen = Size - take;
+    memcpy(m_Stripe, pSrc + take, m_StripeLen);
+}
+
+// ----------------------------------------------------------------------------
+
+// calculate the 64-bit hash of a block of data
+uint64_t CalcHash64(uint8_t const *pBuf, size_t Size, uint64_t Seed)
+{
+    Hash64 hash(Seed);
+
+    hash.Update(pBuf, Size);
+
+    return hash.Final();
+}
+
+}   // namespace cp
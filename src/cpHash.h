@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpHash.h
+//
+//  Description:    Non-Cryptographic Hash Functions.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_HASH_H
+#define CP_HASH_H
+
+#include "cpPlatform.h"
+
+namespace cp
+{
+
+// ----------------------------------------------------------------------------
+
+// Hash64 computes the 64-bit xxHash (XXH64) of a sequence of octets.  It is
+// several times faster than a CRC-32 in software and detects accidental
+// corruption well, but it offers no protection against deliberate tampering.
+// Data may be supplied in pieces of any size; the result is the same as for
+// the whole run at once.
+
+class Hash64
+{
+public:
+    // constructor
+    Hash64(uint64_t Seed = 0);
+
+    // accessors
+    uint64_t Final() const;                                 // return the hash of the data so far
+
+    // manipulators
+    void Reset(uint64_t Seed = 0);                          // start a new hash
+    void Update(void const *pBuf, size_t Size);             // add a block of data to the hash
+
+private:
+    // constants
+    enum Constants { k_StripeSize = 32 };
+
+    uint64_t            m_Seed;                             // starting value
+    uint64_t            m_Total;                            // number of octets hashed
+    uint64_t            m_Acc[4];                           // lane accumulators
+    uint8_t             m_Stripe[k_StripeSize];             // octets waiting for a whole stripe
+    size_t              m_StripeLen;                        // number of octets waiting
+};
+
+// calculate the 64-bit hash of a block of data
+uint64_t CalcHash64(uint8_t const *pBuf, size_t Size, uint64_t Seed = 0);
+
+}   // namespace cp
+
+#endif  // CP_HASH_H
@@ -16,11 +16,14 @@
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2013-04-03  asc Cleared output string in HexEncode().
 //  2022-05-26  asc Made Input buffer to HexEncode a const.
+//  2026-10-16  asc Changed HexEncode() input to a BufferView.
+//  2026-10-16  asc Converted groups of octets with vector kernels into pre-sized output.
 // ----------------------------------------------------------------------------
 
 #include <cstdlib>
 
 #include "cpBuffer.h"
+#include "cpSimd.h"
 #include "cpUtil.h"
 
 namespace cp
@@ -53,9 +56,11 @@ void HexIoCfg::Display()
 
 
 // encode a block of data to ASCII hex
-size_t HexEncode(Buffer const &Input, String &Output, HexIoCfg &Form)
+size_t HexEncode(BufferView const &Input, String &Output, HexIoCfg &Form)
 {
-    Buffer buf(16);
+    size_t i = 0;
+    size_t num = 0;
+    size_t pos = 0;
 
     // clear the output string
     Output.clear();
@@ -73,17 +78,32 @@ size_t HexEncode(Buffer const &Input, String &Output, HexIoCfg &Form)
         Form.lineLen = 0;
     }
 
-    // convert the input data to hex
-    for (size_t i = 0; i < Input.LenGet(); ++i)
+    // reserve room for the digits and the most formatting each group can add
+    Output.reserve((Input.LenGet() * k_OutputCharsPerInputOctet) +
+                   (((Input.LenGet() / Form.groupLenMax) + 2) *
+                    (Form.prefix.size() + Form.suffix.size() + (3 * Form.separator.size()) + 1)));
+
+    // convert the input data to hex a group at a time
+    while (i < Input.LenGet())
     {
         // insert any formatting items
         FormatOutput(Output, Form);
 
-        // convert and add an octet
-        snprintf(buf, buf, "%2.2x", *Input.u_str(i));
-        Output += buf.c_str();
-        Form.lineLen += k_OutputCharsPerInputOctet;
-        ++Form.groupLen;
+        // convert and add the rest of the group
+        num = Form.groupLenMax - Form.groupLen;
+
+        if (num > (Input.LenGet() - i))
+        {
+            num = Input.LenGet() - i;
+        }
+
+        pos = Output.size();
+        Output.resize(pos + (num * k_OutputCharsPerInputOctet));
+        HexEncodeArray(&Output[pos], Input.u_str(i), num);
+
+        Form.lineLen += num * k_OutputCharsPerInputOctet;
+        Form.groupLen += num;
+        i += num;
     }
 
     // post-data formatting
@@ -100,10 +120,9 @@ size_t HexEncode(Buffer const &Input, String &Output, HexIoCfg &Form)
 // decode a block of ASCII hex data
 size_t HexDecode(String const &Input, Buffer &Output)
 {
-    char ch = 0;
+    int val = 0;
+    int element = -1;
     size_t index = 0;
-    String hexDigits = "0123456789ABCDEFabcdef";
-    String element;
 
     // resize and clear the buffer
     Output.Resize(Input.size() / 2);
@@ -111,33 +130,56 @@ size_t HexDecode(String const &Input, Buffer &Output)
     // decode the input hex data
     for (size_t i = 0; i < Input.size(); ++i)
     {
+        // convert runs of digit pairs in bulk when no digit is pending
+        if (element < 0)
+        {
+            size_t num = (Input.size() - i) / k_OutputCharsPerInputOctet;
+
+            if (num > (Output.Size() - index))
+            {
+                num = Output.Size() - index;
+            }
+
+            num = HexDecodeArray(Output.u_str(index), Input.c_str() + i, num);
+            index += num;
+            i += num * k_OutputCharsPerInputOctet;
+
+            if (i >= Input.size())
+            {
+                break;
+            }
+        }
+
         // get a digit
-        ch = Input[i];
+        val = HexDigitVal(Input[i]);
 
         // discard any C hex prefix (0x)
-        if ( ((ch == 'x') || (ch == 'X')) && (element == "0"))
+        if (((Input[i] == 'x') || (Input[i] == 'X')) && (element == 0))
         {
-           element.clear();
+            element = -1;
         }
 
         // check if a valid hex digit was read
-        if (hexDigits.find(ch) != String::npos)
+        if (val < 0)
         {
-            // concatenate it to the element string
-            element += ch;
+            continue;
         }
 
         // check if a pair of hex digits are ready to decode
-        if (element.size() == k_OutputCharsPerInputOctet)
+        if (element < 0)
+        {
+            element = val;
+        }
+        else
         {
             // translate and write the octet to the output buffer
             if (Output.Size() > index)
             {
-                *Output.u_str(index++) = strtoul(element.c_str(), NULL, 16);
+                *Output.u_str(index++) = static_cast<uint8_t>((element << 4) | val);
             }
 
             // clear the processed element
-            element.clear();
+            element = -1;
         }
     }
 
@@ -148,6 +190,28 @@ size_t HexDecode(String const &Input, Buffer &Output)
 }
 
 
+// return the value of a hex digit, or -1 if it is not one
+int HexDigitVal(char Ch)
+{
+    if ((Ch >= '0') && (Ch <= '9'))
+    {
+        return Ch - '0';
+    }
+
+    if ((Ch >= 'a') && (Ch <= 'f'))
+    {
+        return Ch - 'a' + 10;
+    }
+
+    if ((Ch >= 'A') && (Ch <= 'F'))
+    {
+        return Ch - 'A' + 10;
+    }
+
+    return -1;
+}
+
+
 // insert formatting tokens into output
 static void FormatOutput(String &Output, HexIoCfg &Form, bool Final)
 {
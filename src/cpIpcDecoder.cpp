@@ -13,6 +13,7 @@
 //
 //  History:
 //  2013-01-18  asc Creation.
+//  2026-10-16  asc Assembled raw messages on first use and added in-place view.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcDecoder.h"
@@ -22,6 +23,7 @@ namespace cp
 
 // copy constructor
 IpcDecoder::IpcDecoder(IpcDecoder &rhs) :
+    m_BufPending(false),
     m_Message("Decoded")
 {
     // invoke the assignment operator
@@ -49,6 +51,7 @@ bool IpcDecoder::LoadSegment(IpcSegment *pSeg)
 {
     bool rv = false;
 
+    m_BufPending = false;
     m_Buffer.Clear();
     m_Message.Clear();
     m_Stream.Clear();
@@ -65,9 +68,9 @@ bool IpcDecoder::LoadSegment(IpcSegment *pSeg)
             // intentional fall-through
 
         case cp::IpcSegment::msg_Control:
-            // copy it into the buffer
-            m_Stream.Seek(0);
-            rv = (m_Stream.Read(m_Buffer, m_Stream.LenGet()) == m_Stream.LenGet());
+            // copied into the buffer only if a handler asks for it
+            m_BufPending = true;
+            rv = true;
             break;
 
         case cp::IpcSegment::msg_Datum:
@@ -84,4 +87,38 @@ bool IpcDecoder::LoadSegment(IpcSegment *pSeg)
 }
 
 
+// return raw message, assembling it on first use
+Buffer &IpcDecoder::Buf()
+{
+    if (m_BufPending)
+    {
+        m_BufPending = false;
+        m_Stream.Seek(0);
+
+        if (m_Stream.Read(m_Buffer, m_Stream.LenGet()) != m_Stream.LenGet())
+        {
+            LogErr << "IpcDecoder::Buf(): Failed to assemble message, instance: "
+                   << this << std::endl;
+        }
+    }
+
+    return m_Buffer;
+}
+
+
+// return view of raw message, in place if possible
+BufferView IpcDecoder::View()
+{
+    IpcSegment const *pHead = m_Stream.ListHead();
+
+    // a single segment message is viewed directly in its segment
+    if (m_BufPending && (pHead != NULL) && (pHead->NextGet() == NULL))
+    {
+        return pHead->DataView();
+    }
+
+    return BufferView(Buf());
+}
+
+
 }   // namespace cp
@@ -13,6 +13,7 @@
 //
 //  History:
 //  2013-01-18  asc Creation.
+//  2026-10-16  asc Assembled raw messages on first use and added in-place view.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_IPCDECODER_H
@@ -30,6 +31,7 @@ class IpcDecoder : public PooledBase
 public:
     // constructor
     IpcDecoder() :
+        m_BufPending(false),
         m_Message("Decoded")
     {}
 
@@ -37,7 +39,8 @@ public:
     ~IpcDecoder() {}
 
     // accessors
-    Buffer &Buf()                       { return m_Buffer;  }
+    Buffer &Buf();                                          // return raw message, assembling it on first use
+    BufferView View();                                      // return view of raw message, in place if possible
     Datum &Msg()                        { return m_Message; }
     IpcStreamSeg &Stream()              { return m_Stream;  }
 
@@ -51,6 +54,7 @@ private:
     // operators
     IpcDecoder &operator=(IpcDecoder &rhs);
 
+    bool                m_BufPending;                       // raw message not yet copied into the buffer
     Buffer              m_Buffer;                           // buffer containing decoded message
     Datum               m_Message;                          // Datum containing decoded message
     IpcStreamSeg        m_Stream;                           // segment stream used to decode incoming Datum
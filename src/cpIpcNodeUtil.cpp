@@ -16,6 +16,7 @@
 //  2013-03-22  asc Added support for accumulator timeout handling.
 //  2013-04-24  asc Added ReleaseThread() method.
 //  2013-08-21  asc Removed inactivity timer.  Checking timeouts at message arrival.
+//  2026-10-16  asc Constructed accumulators in place and erased them by iterator.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcNode.h"
@@ -229,8 +230,9 @@ void *IpcAccumMap::AccumThread(Thread *pThread)
                     // get the globally unique message id
                     uint64_t guid = pSegment->Guid();
 
-                    // get a reference to the appropriate accumulator
-                    IpcAccum &accum = pAccumMap->m_AccumMap[guid];
+                    // find or construct in place the appropriate accumulator
+                    AccumMap_t::iterator iAccum = pAccumMap->m_AccumMap.try_emplace(guid).first;
+                    IpcAccum &accum = iAccum->second;
 
                     // submit the segment to its accumulator
                     accum.SubmitSegment(pSegment);
@@ -243,7 +245,7 @@ void *IpcAccumMap::AccumThread(Thread *pThread)
                         accum.MessageGet(pSegment);
 
                         // delete the accumulator
-                        pAccumMap->m_AccumMap.erase(guid);
+                        pAccumMap->m_AccumMap.erase(iAccum);
                     }
                     else
                     {
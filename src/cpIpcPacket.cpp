@@ -14,6 +14,7 @@
 //  History:
 //  2012-09-28  asc Creation.
 //  2013-08-22  asc Removed MoveMsgIn() to decouple from Dispatch class.
+//  2026-10-16  asc Decoded messages into a memory region owned by the packet.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcPacket.h"
@@ -23,6 +24,7 @@ namespace cp
 
 // copy constructors
 IpcPacket::IpcPacket(IpcPacket &rhs) :
+    m_Region(),
     m_Rsp("Response")
 {
     // invoke the assignment operator
@@ -52,8 +54,13 @@ bool IpcPacket::PtrSeg(IpcSegment *pSegment)
     // by the decoder and will be deleted in the next operation
     m_PtrSeg = pSegment;
 
-    // load the segment stream in the decoder
+    // release the previous message before rewinding the region that holds it
     // this deletes any existing loaded segments
+    m_Decoder.LoadSegment(NULL);
+    m_Region.Reset();
+
+    // load the segment stream in the decoder with the region bound
+    MemRegion::Scope scope(m_Region);
     return m_Decoder.LoadSegment(pSegment);
 }
 
@@ -15,6 +15,8 @@
 //  2012-09-28  asc Creation.
 //  2013-07-17  asc Removed unused member variables.
 //  2013-08-22  asc Removed MoveMsgIn() to decouple from Dispatch class.
+//  2026-10-16  asc Decoded messages into a memory region owned by the packet.
+//  2026-10-16  asc Added in-place view of raw messages.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_IPCPACKET_H
@@ -24,11 +26,16 @@
 #include "cpIpcStreamSeg.h"
 #include "cpIpcDecoder.h"
 #include "cpIpcNode.h"
+#include "cpMemRegion.h"
 #include "cpUtil.h"
 
 namespace cp
 {
 
+// The decoded message is built in a memory region owned by the packet and
+// recovered all at once when the packet is destroyed or the next segment is
+// loaded.  Data that must outlive the packet is to be copied out of Msg().
+
 class IpcPacket : public PooledBase
 {
 public:
@@ -37,6 +44,7 @@ public:
         m_PtrNode(NULL),
         m_PtrSeg(NULL),
         m_PtrCur(NULL),
+        m_Region(),
         m_Rsp("Response")
     {
         CurrentSet();
@@ -65,6 +73,7 @@ public:
     Datum &Rsp()             { return  m_Rsp;           }
     Datum &Msg()             { return  m_Decoder.Msg(); }
     Buffer &Buf()            { return  m_Decoder.Buf(); }
+    BufferView View()        { return  m_Decoder.View(); }
 
     bool ParamSelect(cp::String const Key) { return Cur().Select(Key); }
     Variant const &ParamGet() { return Cur().Get().Val(); }
@@ -85,6 +94,7 @@ private:
     IpcNode            *m_PtrNode;                          // IPC Node used for communications to remote client
     IpcSegment         *m_PtrSeg;                           // segment list comprising incoming message
     Datum              *m_PtrCur;                           // pointer to Datum containing current message
+    MemRegion           m_Region;                           // decode scratch memory (must precede m_Decoder)
     Datum               m_Rsp;                              // Datum containing response
     IpcDecoder          m_Decoder;                          // message decoder object
 };
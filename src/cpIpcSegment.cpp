@@ -13,6 +13,8 @@
 //
 //  History:
 //  2012-09-28  asc Creation.
+//  2026-10-16  asc Shared the source buffer on copy and added move operations.
+//  2026-10-16  asc Added payload access through BufferView.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcSegment.h"
@@ -42,7 +44,6 @@ IpcSegment::IpcSegment() :
 
 // copy constructor
 IpcSegment::IpcSegment(IpcSegment const &rhs) :
-    m_Buffer(seg_MaxLen),
     m_NextSeg(NULL)
 {
     // invoke assignment operator
@@ -53,6 +54,18 @@ IpcSegment::IpcSegment(IpcSegment const &rhs) :
 }
 
 
+// move constructor
+IpcSegment::IpcSegment(IpcSegment &&rhs) :
+    m_NextSeg(NULL)
+{
+    // invoke move assignment operator
+    *this = std::move(rhs);
+
+    // update the debug instrumentation
+    IncCreate();
+}
+
+
 // destructor
 IpcSegment::~IpcSegment()
 {
@@ -158,6 +171,13 @@ bool IpcSegment::DataGet(Buffer &Buf) const
 }
 
 
+// returns a view of the payload data in place
+BufferView IpcSegment::DataView() const
+{
+    return BufferView(m_Buffer.u_str(seg_Data), DataLen());
+}
+
+
 // returns the globally unique ID (src addr + msg id)
 uint64_t IpcSegment::Guid() const
 {
@@ -295,6 +315,13 @@ bool IpcSegment::DataSet(Buffer const &Data)
 }
 
 
+// stores the payload data
+bool IpcSegment::DataSet(BufferView const &Data)
+{
+    return DataSet(Data.c_str(), Data.LenGet());
+}
+
+
 // stores the payload data
 bool IpcSegment::DataSet(char const *pBuf, size_t Len)
 {
@@ -340,6 +367,14 @@ IpcSegment &IpcSegment::operator=(IpcSegment const &rhs)
         return *this;
     }
 
+    // share the source buffer when it is full size (copied on first write)
+    m_Buffer = rhs.m_Buffer;
+
+    if (m_Buffer.Size() >= seg_MaxLen)
+    {
+        return *this;
+    }
+
     // resize the buffer storage
     m_Buffer.Resize(seg_MaxLen);
 
@@ -355,6 +390,35 @@ IpcSegment &IpcSegment::operator=(IpcSegment const &rhs)
 }
 
 
+// move assignment operator
+IpcSegment &IpcSegment::operator=(IpcSegment &&rhs)
+{
+    // check for self assignment
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    // a source without a full size buffer is copied instead
+    if (rhs.m_Buffer.Size() < seg_MaxLen)
+    {
+        return *this = rhs;
+    }
+
+    // exchange buffers so the source keeps valid storage, then reset it
+    std::swap(m_Buffer, rhs.m_Buffer);
+
+    if (rhs.m_Buffer.Size() < seg_MaxLen)
+    {
+        rhs.m_Buffer.Resize(seg_MaxLen);
+    }
+
+    rhs.Clear();
+
+    return *this;
+}
+
+
 // purge the linked list of attached segments
 void IpcSegment::PurgeList()
 {
@@ -14,6 +14,8 @@
 //  History:
 //  2012-09-28  asc Creation.
 //  2013-08-20  asc Redesigned control code mechanism.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Added payload access through BufferView.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_IPCSEGMENT_H
@@ -100,6 +102,9 @@ public:
     // copy constructor
     IpcSegment(IpcSegment const &rhs);
 
+    // move constructor
+    IpcSegment(IpcSegment &&rhs);
+
     // destructor
     ~IpcSegment();
 
@@ -118,6 +123,7 @@ public:
 
     uint32_t DataGet() const;                               // returns the first long word in the payload buffer
     bool DataGet(Buffer &Data) const;                       // returns the payload data
+    BufferView DataView() const;                            // returns a view of the payload data in place
     Buffer &Buf() { return m_Buffer; }                      // returns the internal buffer
     Buffer const &Buf() const { return m_Buffer; }          // returns the internal buffer as const
 
@@ -141,12 +147,14 @@ public:
 
     bool DataSet(uint32_t Value);                           // stores a long word as the payload
     bool DataSet(Buffer const &Data);                       // stores the payload data
+    bool DataSet(BufferView const &Data);                   // stores the payload data
     bool DataSet(char const *pBuf, size_t Len);             // stores the payload data
 
     void Clear();                                           // sets the segment contents to default values
 
     // operators
     IpcSegment &operator=(IpcSegment const &rhs);           // overridden assignment operator
+    IpcSegment &operator=(IpcSegment &&rhs);                // move assignment operator
 
     // list accessors
     IpcSegment *NextGet() { return m_NextSeg; }
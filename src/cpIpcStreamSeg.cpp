@@ -16,6 +16,8 @@
 //  2012-12-14  asc Added copy constructor and assignment operator.
 //  2013-04-22  asc Added conversion assignment operator from Buffer.
 //  2013-08-29  asc Refactored Clear() operation to eliminate inheritance pitfalls.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Indexed the segment list for random access to blocks.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcStreamSeg.h"
@@ -25,7 +27,6 @@ namespace cp
 
 // constructor
 IpcStreamSeg::IpcStreamSeg(size_t Size) :
-    m_BlockCount(0),
     m_PtrHead(NULL),
     m_PtrTail(NULL)
 {
@@ -35,7 +36,6 @@ IpcStreamSeg::IpcStreamSeg(size_t Size) :
 
 // copy constructor
 IpcStreamSeg::IpcStreamSeg(IpcStreamSeg &rhs) :
-    m_BlockCount(0),
     m_PtrHead(NULL),
     m_PtrTail(NULL)
 {
@@ -44,6 +44,16 @@ IpcStreamSeg::IpcStreamSeg(IpcStreamSeg &rhs) :
 }
 
 
+// move constructor
+IpcStreamSeg::IpcStreamSeg(IpcStreamSeg &&rhs) :
+    m_PtrHead(NULL),
+    m_PtrTail(NULL)
+{
+    // invoke the move assignment operator
+    *this = std::move(rhs);
+}
+
+
 // destructor
 IpcStreamSeg::~IpcStreamSeg()
 {
@@ -70,6 +80,35 @@ IpcStreamSeg &IpcStreamSeg::operator=(IpcStreamSeg &rhs)
 }
 
 
+// move assignment operator
+IpcStreamSeg &IpcStreamSeg::operator=(IpcStreamSeg &&rhs)
+{
+    // check for self assignment
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    Clear();
+
+    // take the segment list and the stream state
+    m_VecSegs.swap(rhs.m_VecSegs);
+    m_PtrHead = rhs.m_PtrHead;
+    m_PtrTail = rhs.m_PtrTail;
+    m_CurBlock = rhs.m_CurBlock;
+    m_CurPos = rhs.m_CurPos;
+    m_LastBlock = rhs.m_LastBlock;
+    m_LastPos = rhs.m_LastPos;
+
+    // leave the source empty without freeing the segments
+    rhs.m_PtrHead = NULL;
+    rhs.m_PtrTail = NULL;
+    rhs.Clear();
+
+    return *this;
+}
+
+
 // conversion assignment operator
 IpcStreamSeg &IpcStreamSeg::operator=(Buffer const &rhs)
 {
@@ -92,7 +131,7 @@ void IpcStreamSeg::SegmentInject(IpcSegment *pSeg)
 
         // assign the head and tail
         m_PtrHead = pSeg;
-        ++m_BlockCount;
+        m_VecSegs.push_back(pSeg);
 
         // locate the tail
         m_PtrTail = m_PtrHead;
@@ -101,7 +140,7 @@ void IpcStreamSeg::SegmentInject(IpcSegment *pSeg)
         while (ptr)
         {
             ++m_LastBlock;
-            ++m_BlockCount;
+            m_VecSegs.push_back(ptr);
             m_PtrTail = ptr;
             ptr = ptr->NextGet();
         }
@@ -155,7 +194,7 @@ void IpcStreamSeg::MemoryFree()
     }
 
     // clear the block storage
-    m_BlockCount = 0;
+    m_VecSegs.clear();
     m_PtrHead = NULL;
     m_PtrTail = NULL;
 }
@@ -180,8 +219,8 @@ bool IpcStreamSeg::MemoryAdd(size_t Size)
 
         if (ptr)
         {
-            // update the block count
-            ++m_BlockCount;
+            // index the new segment
+            m_VecSegs.push_back(ptr);
 
             if (m_PtrHead == NULL)
             {
@@ -213,7 +252,7 @@ bool IpcStreamSeg::MemoryAdd(size_t Size)
             }
 
             // set the block number
-            ptr->FragNum(m_BlockCount);
+            ptr->FragNum(m_VecSegs.size());
         }
         else
         {
@@ -239,7 +278,7 @@ bool IpcStreamSeg::MemoryChk() const
 // returns true if block is valid
 bool IpcStreamSeg::ValidBlock(size_t Block) const
 {
-    return (Block < m_BlockCount);
+    return (Block < m_VecSegs.size());
 }
 
 
@@ -247,20 +286,11 @@ bool IpcStreamSeg::ValidBlock(size_t Block) const
 char *IpcStreamSeg::BlockMemPtr(size_t Block) const
 {
     char *pBuf = NULL;
-    IpcSegment *pSeg = m_PtrHead;
-    size_t seg = Block;
-
-    // seek to the current block
-    while (seg && pSeg)
-    {
-        pSeg = pSeg->NextGet();
-        --seg;
-    }
 
     // get the buffer
-    if (pSeg && (seg == 0))
+    if (ValidBlock(Block))
     {
-        pBuf = pSeg->Buf().c_str(IpcSegment::seg_Data);
+        pBuf = m_VecSegs[Block]->Buf().c_str(IpcSegment::seg_Data);
     }
 
     return pBuf;
@@ -16,6 +16,8 @@
 //  2012-12-14  asc Added copy constructor and assignment operator.
 //  2013-04-22  asc Added conversion assignment operator from Buffer.
 //  2013-08-29  asc Refactored Clear() operation to eliminate inheritance pitfalls.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Indexed the segment list for random access to blocks.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_IPCSTREAMSEG_H
@@ -27,6 +29,9 @@
 namespace cp
 {
 
+// local custom types
+typedef std::vector<IpcSegment *, Alloc<IpcSegment *> > IpcSegVec_t;
+
 // ----------------------------------------------------------------------------
 
 // the stream segment class
@@ -39,11 +44,15 @@ public:
     // copy constructor
     IpcStreamSeg(IpcStreamSeg &rhs);
 
+    // move constructor
+    IpcStreamSeg(IpcStreamSeg &&rhs);
+
     // destructor
     ~IpcStreamSeg();
 
     // operators
     IpcStreamSeg &operator=(IpcStreamSeg &rhs);             // overridden assignment operator
+    IpcStreamSeg &operator=(IpcStreamSeg &&rhs);            // move assignment operator
     IpcStreamSeg &operator=(Buffer const &rhs);             // conversion assignment operator
 
     // accessors
@@ -67,7 +76,7 @@ protected:
     virtual size_t BlockSize(size_t Block) const;           // returns specified memory block size
 
 private:
-    size_t              m_BlockCount;                       // number of comm segments in list
+    IpcSegVec_t         m_VecSegs;                          // index of the comm segments in list order
     IpcSegment          m_Template;                         // template for segment field values
     IpcSegment         *m_PtrHead;                          // head to list of comm segments
     IpcSegment         *m_PtrTail;                          // tail to list of comm segments
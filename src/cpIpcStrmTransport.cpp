@@ -13,6 +13,7 @@
 //
 //  History:
 //  2013-04-06  asc Creation.
+//  2026-10-16  asc Skipped zero fill of the header buffer.
 // ----------------------------------------------------------------------------
 
 #include "cpIpcStrmTransport.h"
@@ -194,7 +195,7 @@ bool IpcStrmTransport::EncodeHeader(cp::Buffer &Header, OpCodes OpCode, size_t L
 {
     uint8_t *ptr = NULL;
 
-    if (Header.Resize(k_IpcStrmHeaderLen))
+    if (Header.Resize(k_IpcStrmHeaderLen, false))
     {
         ptr = Header.u_str();
 
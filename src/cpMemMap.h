@@ -0,0 +1,53 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpMemMap.h
+//
+//  Description:    Memory Page and File Mapping Facility.  This is a
+//                  low dependency page provider for MemManager and
+//                  file mapper for StreamMap.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added read-only file mapping.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_MEMMAP_H
+#define CP_MEMMAP_H
+
+#include "cpPlatform.h"
+
+namespace cp
+{
+
+class MemMap
+{
+public:
+    // map anonymous read/write memory, Size is rounded up to the mapping granularity
+    static void *Map(size_t &Size, bool HugePage);
+
+    // release memory returned by Map()
+    static bool Unmap(void *Ptr, size_t Size);
+
+    // touch every page so later accesses do not fault
+    static void Prefault(void *Ptr, size_t Size);
+
+    // lock pages in physical memory
+    static bool Lock(void *Ptr, size_t Size);
+
+    // map a file with private copy-on-write pages, an empty file maps to NULL
+    static bool MapFile(char const *Path, void * &Ptr, size_t &Size, bool Sequential);
+
+    // release a mapping returned by MapFile()
+    static bool UnmapFile(void *Ptr, size_t Size);
+};
+
+}   // namespace cp
+
+#endif  // CP_MEMMAP_H
@@ -17,9 +17,24 @@
 //  2012-11-28  asc Eliminated MemManager destructor due to static initializer issue.
 //  2023-03-28  asc Added mutex protection to CreatePool() so it can be used by application.
 //  2023-03-28  asc Added parameter to control block level details in StatusLog().
+//  2026-10-16  asc Added per-thread block cache (MemCache) in front of the pools.
+//  2026-10-16  asc Added size class lookup table and owning pool in MemBlock header.
+//  2026-10-16  asc Added segment occupancy tracking, Trim() and pool high-water limit.
+//  2026-10-16  asc Added mapped and huge page segment provider options.
+//  2026-10-16  asc Added lock-free return stack to MemPool for cache drains.
+//  2026-10-16  asc Added LIFO block reuse option.
+//  2026-10-16  asc Allowed independently constructed MemManager arenas.
+//  2026-10-16  asc Served requests from a thread's bound MemRegion and ignored region block returns.
+//  2026-10-16  asc Added request size histogram and pool configuration tuning.
 // ----------------------------------------------------------------------------
 
+#include <fstream>
+#include <sstream>
+#include <vector>
+
 #include "cpMemMgr.h"
+#include "cpMemMap.h"
+#include "cpMemRegion.h"
 
 namespace cp
 {
@@ -27,6 +42,9 @@ namespace cp
 // initialize static singleton instance
 MemManager *MemManager::pInstance = NULL;
 
+// state of the calling thread's cache (0 = not created, 1 = live, 2 = destroyed)
+static thread_local int t_CacheState = 0;
+
 
 // ============================================================================
 // MemBlock
@@ -34,10 +52,12 @@ MemManager *MemManager::pInstance = NULL;
 
 
 // constructor
-MemBlock::MemBlock(size_t BlockSize) :
+MemBlock::MemBlock(size_t BlockSize, MemSegment *Seg) :
     m_Guard(0),
     m_UseCount(0),
-    m_BlockSize(BlockSize)
+    m_RefCount(0),
+    m_BlockSize(BlockSize),
+    m_Segment(Seg)
 {
 }
 
@@ -73,7 +93,14 @@ void MemBlock::StatusLog(std::ostream &Out) const
 
 
 // constructor
-MemSegment::MemSegment() : m_Next(NULL)
+MemSegment::MemSegment(MemPool *Pool, uint32_t Blocks, bool Pinned, size_t MapSize) :
+    m_Next(NULL),
+    m_Pool(Pool),
+    m_Count(Blocks),
+    m_Free(0),
+    m_MapSize(MapSize),
+    m_Pinned(Pinned),
+    m_Reclaim(false)
 {
 }
 
@@ -90,18 +117,35 @@ MemSegment::~MemSegment()
 
 
 // constructor
-MemPool::MemPool(size_t BlockSize, uint32_t InitCount, uint32_t Increment) :
+MemPool::MemPool(MemManager *Mgr, size_t BlockSize, uint32_t InitCount, uint32_t Increment,
+                 uint32_t HighWater, uint32_t Options) :
+    m_Mgr(Mgr),
     m_BlockSize(BlockSize),
     m_Increment(Increment),
     m_TotalBlocks(0),
     m_Inventory(0),
     m_PeakUsed(0),
+    m_Cached(0),
+    m_HighWater(HighWater),
+    m_Options(Options),
+    m_SegCount(0),
+    m_IdleSegs(0),
+    m_Released(0),
     m_SegHead(NULL),
     m_BlkHead(NULL),
     m_BlkTail(NULL),
+    m_PushHead(NULL),
+    m_PushCount(0),
     m_Next(NULL)
 {
-   if (AllocateSegment(InitCount) == false)
+   // all page options imply a mapped segment provider
+   if (m_Options & (opt_HugePage | opt_Prefault | opt_Lock))
+   {
+       m_Options |= opt_Mapped;
+   }
+
+   // the initial segment is never released
+   if (AllocateSegment(InitCount, true) == false)
    {
        LogErr << "MemPool::MemPool(): Failed to create initial memory segment for size: "
               << m_BlockSize << std::endl;
@@ -118,7 +162,7 @@ MemPool::~MemPool()
     while (pSeg != NULL)
     {
         m_SegHead = pSeg->NextGet();
-        delete [] reinterpret_cast<char *>(pSeg);
+        ReleaseSegment(pSeg);
         pSeg = m_SegHead;
     }
 }
@@ -129,6 +173,12 @@ bool MemPool::MemBlockGet(MemBlock * &Mem)
 {
     bool rv = true;
 
+    // take in any blocks returned without locking
+    if (m_BlkHead == NULL)
+    {
+        Collect();
+    }
+
     // check block inventory
     if (m_BlkHead == NULL)
     {
@@ -157,12 +207,15 @@ bool MemPool::MemBlockGet(MemBlock * &Mem)
                 m_BlkTail = NULL;
             }
 
-            // increment the block's usage count
-            Mem->UseCountInc();
-
             // update inventory
             --m_Inventory;
 
+            // update segment occupancy
+            if (Mem->SegmentGet()->FreeDec())
+            {
+                --m_IdleSegs;
+            }
+
             // update peak usage
             if ((m_TotalBlocks - m_Inventory) > m_PeakUsed)
             {
@@ -192,10 +245,10 @@ bool MemPool::MemBlockPut(MemBlock * &Mem)
         rv = false;
     }
 
-    // check that block matches this pool's block size
+    // check that block belongs to this pool
     if (rv)
     {
-        if (Mem->SizeGet() != m_BlockSize)
+        if ((Mem->SizeGet() != m_BlockSize) || (Mem->PoolGet() != this))
         {
             rv = false;
         }
@@ -207,18 +260,29 @@ bool MemPool::MemBlockPut(MemBlock * &Mem)
         if (m_BlkHead == NULL)
         {
             // set both tail and head point to the only block
+            Mem->NextSet(NULL);
             m_BlkHead = Mem;
             m_BlkTail = Mem;
         }
+        else if (m_Options & opt_Lifo)
+        {
+            // insert block at the head so the cache-warm block is reused next
+            Mem->NextSet(m_BlkHead);
+            m_BlkHead = Mem;
+        }
         else
         {
-            // insert block at the tail
+            // insert block at the tail and terminate final list entry
+            Mem->NextSet(NULL);
             m_BlkTail->NextSet(Mem);
             m_BlkTail = Mem;
         }
 
-        // terminate final list entry
-        Mem->NextSet(NULL);
+        // update segment occupancy
+        if (Mem->SegmentGet()->FreeInc())
+        {
+            ++m_IdleSegs;
+        }
 
         // clear the pointer reference
         Mem = NULL;
@@ -231,6 +295,161 @@ bool MemPool::MemBlockPut(MemBlock * &Mem)
 }
 
 
+// release idle segments until the inventory is no larger than the target
+size_t MemPool::Trim(uint32_t Target)
+{
+    MemSegment *pSeg;
+    MemSegment *pPrevSeg = NULL;
+    MemBlock *pBlk;
+    MemBlock *pPrevBlk = NULL;
+    uint32_t inventory = m_Inventory;
+    size_t released = 0;
+
+    // idle segments may be waiting on the returned stack
+    Collect();
+
+    if ((m_IdleSegs == 0) || (m_Inventory <= Target))
+    {
+        return 0;
+    }
+
+    // select idle segments for release
+    for (pSeg = m_SegHead; (pSeg != NULL) && (inventory > Target); pSeg = pSeg->NextGet())
+    {
+        if (pSeg->Idle())
+        {
+            pSeg->ReclaimSet(true);
+            inventory -= pSeg->CountGet();
+        }
+    }
+
+    // unlink the blocks of the selected segments from the inventory
+    pBlk = m_BlkHead;
+
+    while (pBlk != NULL)
+    {
+        MemBlock *pNext = pBlk->NextGet();
+
+        if (pBlk->SegmentGet()->ReclaimGet())
+        {
+            if (pPrevBlk == NULL)
+            {
+                m_BlkHead = pNext;
+            }
+            else
+            {
+                pPrevBlk->NextSet(pNext);
+            }
+        }
+        else
+        {
+            pPrevBlk = pBlk;
+        }
+
+        pBlk = pNext;
+    }
+
+    m_BlkTail = pPrevBlk;
+
+    // release the selected segments
+    pSeg = m_SegHead;
+
+    while (pSeg != NULL)
+    {
+        MemSegment *pNext = pSeg->NextGet();
+
+        if (pSeg->ReclaimGet())
+        {
+            if (pPrevSeg == NULL)
+            {
+                m_SegHead = pNext;
+            }
+            else
+            {
+                pPrevSeg->NextSet(pNext);
+            }
+
+            m_TotalBlocks -= pSeg->CountGet();
+            m_Inventory -= pSeg->CountGet();
+            --m_SegCount;
+            --m_IdleSegs;
+            ++m_Released;
+            released += (pSeg->MapSizeGet() > 0) ? pSeg->MapSizeGet() : SegmentSize(pSeg->CountGet());
+
+            ReleaseSegment(pSeg);
+        }
+        else
+        {
+            pPrevSeg = pSeg;
+        }
+
+        pSeg = pNext;
+    }
+
+    return released;
+}
+
+
+// release idle segments above the high-water limit
+size_t MemPool::Reclaim()
+{
+    if ((m_HighWater == 0) || ((m_Inventory + PushedGet()) <= m_HighWater))
+    {
+        return 0;
+    }
+
+    return Trim(m_HighWater);
+}
+
+
+// return a chain of blocks without locking
+void MemPool::MemBlockPush(MemBlock *First, MemBlock *Last, uint32_t Count)
+{
+    MemBlock *pHead = m_PushHead.load(std::memory_order_relaxed);
+
+    // a push never dereferences the current head, so it cannot suffer ABA
+    do
+    {
+        Last->NextSet(pHead);
+    }
+    while (m_PushHead.compare_exchange_weak(pHead, First,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed) == false);
+
+    m_PushCount.fetch_add(Count, std::memory_order_relaxed);
+}
+
+
+// move pushed blocks into the inventory (mutex must be held)
+uint32_t MemPool::Collect()
+{
+    uint32_t count = 0;
+
+    // detach the whole stack at once
+    MemBlock *pBlk = m_PushHead.exchange(NULL, std::memory_order_acquire);
+
+    while (pBlk != NULL)
+    {
+        MemBlock *pNext = pBlk->NextGet();
+
+        MemBlockPut(pBlk);
+        ++count;
+
+        pBlk = pNext;
+    }
+
+    if (count > 0)
+    {
+        m_PushCount.fetch_sub(count, std::memory_order_relaxed);
+
+        // pushed blocks come from thread caches
+        m_Cached -= count;
+    }
+
+    return count;
+}
+
+
 // log block usage statistics
 void MemPool::StatusLog(std::ostream &Out, bool Blocks) const
 {
@@ -239,9 +458,17 @@ void MemPool::StatusLog(std::ostream &Out, bool Blocks) const
         << "  Inc:  "    << std::setw(5) << m_Increment
         << "  Blocks:  " << std::setw(5) << m_TotalBlocks
         << "  Inv:  "    << std::setw(5) << m_Inventory
+        << "  Cached:  " << std::setw(5) << m_Cached
         << "  Peak:  "   << std::setw(5) << m_PeakUsed << std::endl;
+    Out << "  Segs:  "   << std::setw(8) << m_SegCount
+        << "  Idle:  "   << std::setw(5) << m_IdleSegs
+        << "  Released:  " << std::setw(5) << m_Released
+        << "  HiWat:  "  << std::setw(5) << m_HighWater
+        << "  Pushed:  " << std::setw(5) << PushedGet()
+        << "  Opts:  0x" << std::hex << m_Options << std::dec << std::endl;
     Out << "  ----------------------------------";
-    Out << "-------------------------------------" << std::endl;
+    Out << "-------------------------------------";
+    Out << "-----------------" << std::endl;
 
     if (Blocks)
     {
@@ -257,20 +484,56 @@ void MemPool::StatusLog(std::ostream &Out, bool Blocks) const
 
 
 // allocate a segment that holds specified number of blocks
-bool MemPool::AllocateSegment(uint32_t Blocks)
+bool MemPool::AllocateSegment(uint32_t Blocks, bool Pinned)
 {
     bool rv = true;
     MemBlock *pBlk;
     MemSegment *pSeg;
-    char *pRaw;
-    size_t segSize = (Blocks * (m_BlockSize + sizeof(MemBlock))) + sizeof(MemSegment);
+    char *pRaw = NULL;
+    size_t segSize = SegmentSize(Blocks);
+    size_t mapSize = 0;
 
     if (Blocks == 0)
     {
         rv = false;
     }
 
-    if (rv)
+    if (rv && (m_Options & opt_Mapped))
+    {
+        // map pages large enough for all blocks plus the MemSegment object
+        mapSize = segSize;
+        pRaw = reinterpret_cast<char *>(MemMap::Map(mapSize, (m_Options & opt_HugePage) != 0));
+
+        if (pRaw != NULL)
+        {
+            // fill the slack left by rounding up to the page size with more blocks
+            Blocks = static_cast<uint32_t>((mapSize - sizeof(MemSegment)) / (m_BlockSize + sizeof(MemBlock)));
+
+            if (m_Options & opt_Prefault)
+            {
+                MemMap::Prefault(pRaw, mapSize);
+            }
+
+            if ((m_Options & opt_Lock) && Pinned)
+            {
+                if (MemMap::Lock(pRaw, mapSize) == false)
+                {
+                    LogErr << "MemPool::AllocateSegment(): Failed to lock initial segment in memory for size: "
+                           << m_BlockSize << std::endl;
+                }
+            }
+        }
+        else
+        {
+            // stop trying to map and use the heap from now on
+            LogErr << "MemPool::AllocateSegment(): Failed to map segment, using heap for size: "
+                   << m_BlockSize << std::endl;
+            m_Options &= opt_Lifo;
+            mapSize = 0;
+        }
+    }
+
+    if (rv && (pRaw == NULL))
     {
         // allocate a new chunk of memory large enough
         // for all blocks plus the MemSegment object
@@ -285,11 +548,12 @@ bool MemPool::AllocateSegment(uint32_t Blocks)
     if (rv)
     {
         // instantiate a MemSegment in the new chunk of memory
-        pSeg = new (pRaw) MemSegment;
+        pSeg = new (pRaw) MemSegment(this, Blocks, Pinned, mapSize);
 
         // add the segment to the list
         pSeg->NextSet(m_SegHead);
         m_SegHead = pSeg;
+        ++m_SegCount;
 
         // index raw pointer past the MemSegment object
         pRaw += sizeof(MemSegment);
@@ -297,7 +561,7 @@ bool MemPool::AllocateSegment(uint32_t Blocks)
         // carve up remaining memory into blocks and put them in the block inventory
         for (uint32_t i = 0; i < Blocks; ++i)
         {
-            pBlk = new (pRaw) MemBlock(m_BlockSize);
+            pBlk = new (pRaw) MemBlock(m_BlockSize, pSeg);
 
             rv = MemBlockPut(pBlk);
 
@@ -321,165 +585,559 @@ bool MemPool::AllocateSegment(uint32_t Blocks)
 }
 
 
+// return a segment's memory to the system
+void MemPool::ReleaseSegment(MemSegment *Seg)
+{
+    if (Seg->MapSizeGet() > 0)
+    {
+        if (MemMap::Unmap(Seg, Seg->MapSizeGet()) == false)
+        {
+            LogErr << "MemPool::ReleaseSegment(): Failed to unmap segment for size: "
+                   << m_BlockSize << std::endl;
+        }
+    }
+    else
+    {
+        delete [] reinterpret_cast<char *>(Seg);
+    }
+}
+
+
 // ============================================================================
-// MemManager
+// MemCache
 // ============================================================================
 
 
-// destructor
-MemManager::~MemManager()
+// constructor
+MemCache::MemCache() :
+    m_Mgr(NULL),
+    m_PoolGen(0),
+    m_PoolCount(0),
+    m_Deployed(0),
+    m_Returned(0),
+    m_DeployedSize(0),
+    m_HistLo(MemManager::k_HistBins),
+    m_HistHi(0)
 {
-#if 0   // do not destruct -- static initializer race condition
-    MemPool *pPool = m_PoolHead;
-
-    // iterate through list and delete all pools
-    while (pPool != NULL)
-    {
-        m_PoolHead = pPool->NextGet();
-        delete pPool;
-        pPool = m_PoolHead;
-    }
-#endif
+    memset(m_Hist, 0, sizeof(m_Hist));
+    t_CacheState = 1;
 }
 
 
-// get a block of memory
-bool MemManager::MemBlockGet(MemBlock * &Mem, size_t Size)
+// destructor
+MemCache::~MemCache()
 {
-    bool rv = true;
-    MemPool *pPool;
+    Flush();
+    t_CacheState = 2;
+}
 
-    m_Mutex.Lock();
 
-    // find an appropriate pool
-    pPool = PoolGet(Size);
+// get a block from the cache
+bool MemCache::MemBlockGet(MemManager *Mgr, MemBlock * &Mem, size_t Size)
+{
+    Magazine *pMag;
 
-    if (pPool != NULL)
+    // make sure the pool snapshot is current
+    if ((Mgr != m_Mgr) || (m_PoolGen != Mgr->m_PoolGen.load(std::memory_order_acquire)))
     {
-        // found a pool so attempt to get a block
-        rv = pPool->MemBlockGet(Mem);
+        if (Bind(Mgr) == false)
+        {
+            return false;
+        }
     }
-    else
+
+    pMag = MagazineGet(Size);
+
+    if (pMag == NULL)
     {
-        // no appropriate pool, so allocate custom size block
-        char *pRaw = new (CP_NEW) char[Size + sizeof(MemBlock)];
+        return false;
+    }
 
-        if (pRaw != NULL)
-        {
-            Mem = new (pRaw) MemBlock(Size);
-        }
-        else
+    // replenish an empty magazine from its pool
+    if (pMag->m_Count == 0)
+    {
+        if (Refill(*pMag) == false)
         {
-            rv = false;
-            LogErr << "MemManager::MemBlockGet(): Failed to allocate block of custom size: "
-                   << Size << std::endl;
+            return false;
         }
     }
 
-    // update statistics
-    if (rv)
+    Mem = pMag->m_Blocks[--pMag->m_Count];
+
+    // increment the block's usage count
+    Mem->UseCountInc();
+
+    // update local statistics
+    ++m_Deployed;
+    m_DeployedSize += static_cast<uint32_t>(pMag->m_Size);
+
+    uint32_t bin = MemManager::HistBinGet(Size);
+
+    ++m_Hist[bin];
+
+    if (bin < m_HistLo)
     {
-        ++m_DeployedCount;
-        m_DeployedSize += Mem->SizeGet();
+        m_HistLo = bin;
     }
-    else
+
+    if (bin >= m_HistHi)
     {
-        ++m_FailedGets;
+        m_HistHi = bin + 1;
     }
 
-    m_Mutex.Unlock();
-
-    // mark for consistency and protection against multiple returns
-    Mem->GuardOn();
-
-    return rv;
+    return true;
 }
 
 
-// return a block
-bool MemManager::MemBlockPut(MemBlock * &Mem)
+// return a block to the cache
+bool MemCache::MemBlockPut(MemManager *Mgr, MemBlock * &Mem)
 {
-    bool rv = true;
-    MemPool *pPool;
-    size_t size = 0;
+    Magazine *pMag;
+    size_t size = Mem->SizeGet();
 
-    // check validity of memory block
-    if (Mem == NULL)
+    // make sure the pool snapshot is current
+    if ((Mgr != m_Mgr) || (m_PoolGen != Mgr->m_PoolGen.load(std::memory_order_acquire)))
     {
-        return rv;
+        if (Bind(Mgr) == false)
+        {
+            return false;
+        }
     }
-    else
+
+    pMag = MagazineGet(size);
+
+    // blocks that do not belong to a cached pool are handled by the manager
+    if ((pMag == NULL) || (pMag->m_Pool != Mem->PoolGet()))
     {
-        size = Mem->SizeGet();
+        return false;
     }
 
-    // check for integrity and prevent multiple puts
-    if (Mem->Valid() == false)
+    // make room in a full magazine
+    if (pMag->m_Count == pMag->m_Depth)
     {
-        LogErr << "MemManager::MemBlockPut(): Attempted return of invalid memory block: "
-               << Mem << std::endl;
-        return false;
+        Drain(*pMag, pMag->m_Depth / 2);
     }
 
-    // remove integrity guard to prevent multiple return
-    Mem->GuardOff();
+    pMag->m_Blocks[pMag->m_Count++] = Mem;
 
-    m_Mutex.Lock();
+    // clear the pointer reference
+    Mem = NULL;
 
-    // find an appropriate pool
-    pPool = PoolGet(size);
+    // update local statistics
+    ++m_Returned;
+    m_DeployedSize -= static_cast<uint32_t>(size);
 
-    if (pPool != NULL)
+    return true;
+}
+
+
+// return all cached blocks and statistics
+void MemCache::Flush()
+{
+    if (m_Mgr == NULL)
     {
-        // found a pool so attempt to put the block
-        rv = pPool->MemBlockPut(Mem);
+        return;
     }
-    else
-    {
-        // no appropriate pool, so delete the custom size block
-        char *pRaw = reinterpret_cast<char *>(Mem);
 
-        if (pRaw != NULL)
+    // push every cached block back to its pool
+    for (uint32_t i = 0; i < m_PoolCount; ++i)
+    {
+        if (m_Mag[i].m_Count > 0)
         {
-            delete [] pRaw;
-            Mem = NULL;
+            Drain(m_Mag[i], m_Mag[i].m_Count);
         }
     }
 
-    // update statistics
-    if (rv)
-    {
-        ++m_ReturnedCount;
-        m_DeployedSize -= size;
-    }
-    else
+    m_Mgr->m_Mutex.Lock();
+
+    for (uint32_t i = 0; i < m_PoolCount; ++i)
     {
-        ++m_FailedPuts;
+        m_Mgr->m_ReleasedSize += m_Mag[i].m_Pool->Reclaim();
     }
 
-    m_Mutex.Unlock();
+    StatsFold();
 
-    return rv;
+    m_Mgr->m_Mutex.Unlock();
 }
 
 
-// return a block using its buffer pointer
-bool MemManager::MemBlockPut(char * &Mem)
+// accessor of the calling thread's cache
+MemCache *MemCache::InstanceGet()
 {
-    bool rv;
-
-    if (Mem == NULL)
+    // blocks released during thread teardown bypass the cache
+    if (t_CacheState == 2)
     {
-        return true;
+        return NULL;
     }
 
-    // derive a pointer to where the header of the buffer should exist
-    MemBlock *pBlock = reinterpret_cast<MemBlock *>(Mem - sizeof(MemBlock));
+    static thread_local MemCache s_Cache;
 
-    // check for underflow
-    rv = (reinterpret_cast<size_t>(Mem) > reinterpret_cast<size_t>(pBlock));
+    return &s_Cache;
+}
 
-    // return the memory block
+
+// attach to a manager and snapshot its pools
+bool MemCache::Bind(MemManager *Mgr)
+{
+    // a cache serves the first manager that uses it
+    if ((m_Mgr != NULL) && (m_Mgr != Mgr))
+    {
+        return false;
+    }
+
+    // return blocks held against the stale snapshot
+    Flush();
+
+    Mgr->m_Mutex.Lock();
+
+    m_Mgr = Mgr;
+    m_PoolGen = Mgr->m_PoolGen.load(std::memory_order_relaxed);
+    m_PoolCount = 0;
+
+    // the size class table indexes pools in the same order as the magazines
+    memcpy(m_SizeClass, Mgr->m_SizeClass, sizeof(m_SizeClass));
+
+    // pools beyond the cache's capacity are served by the manager directly
+    while ((m_PoolCount < Mgr->m_PoolCount) && (m_PoolCount < k_MaxPools))
+    {
+        MemPool *pPool = Mgr->m_Pools[m_PoolCount];
+        Magazine &mag = m_Mag[m_PoolCount++];
+
+        mag.m_Pool = pPool;
+        mag.m_Size = pPool->SizeGet();
+        mag.m_Count = 0;
+
+        // hold about one segment increment, within limits
+        mag.m_Depth = pPool->IncrementGet();
+
+        if (mag.m_Depth > k_MaxDepth)
+        {
+            mag.m_Depth = k_MaxDepth;
+        }
+
+        if (mag.m_Depth < 2)
+        {
+            mag.m_Depth = 2;
+        }
+    }
+
+    Mgr->m_Mutex.Unlock();
+
+    return true;
+}
+
+
+// return the magazine of sufficient block size
+MemCache::Magazine *MemCache::MagazineGet(size_t Size)
+{
+    uint32_t i = m_SizeClass[MemManager::SizeClassGet(Size)];
+
+    // at most the pools sharing this size class are examined
+    while ((i < m_PoolCount) && (m_Mag[i].m_Size < Size))
+    {
+        ++i;
+    }
+
+    return (i < m_PoolCount) ? &m_Mag[i] : NULL;
+}
+
+
+// withdraw a batch of blocks from the pool
+bool MemCache::Refill(Magazine &Mag)
+{
+    MemBlock *pBlk;
+    uint32_t count = 0;
+
+    m_Mgr->m_Mutex.Lock();
+
+    while (count < (Mag.m_Depth / 2))
+    {
+        if (Mag.m_Pool->MemBlockGet(pBlk) == false)
+        {
+            break;
+        }
+
+        Mag.m_Blocks[count++] = pBlk;
+    }
+
+    Mag.m_Count = count;
+    Mag.m_Pool->CachedAdd(count);
+
+    StatsFold();
+
+    m_Mgr->m_Mutex.Unlock();
+
+    return (count > 0);
+}
+
+
+// return the oldest blocks to the pool
+void MemCache::Drain(Magazine &Mag, uint32_t Count)
+{
+    MemPool *pPool = Mag.m_Pool;
+
+    // link the blocks into a chain and push it in one operation
+    for (uint32_t i = 0; (i + 1) < Count; ++i)
+    {
+        Mag.m_Blocks[i]->NextSet(Mag.m_Blocks[i + 1]);
+    }
+
+    pPool->MemBlockPush(Mag.m_Blocks[0], Mag.m_Blocks[Count - 1], Count);
+
+    // keep the most recently returned blocks
+    Mag.m_Count -= Count;
+    memmove(Mag.m_Blocks, Mag.m_Blocks + Count, Mag.m_Count * sizeof(MemBlock *));
+
+    // reclaim opportunistically when the pool is over its limit and the mutex is free
+    if ((pPool->HighWaterGet() > 0) && (pPool->PushedGet() > pPool->HighWaterGet()))
+    {
+        if (m_Mgr->m_Mutex.TryLock())
+        {
+            m_Mgr->m_ReleasedSize += pPool->Reclaim();
+            StatsFold();
+            m_Mgr->m_Mutex.Unlock();
+        }
+    }
+}
+
+
+// fold local statistics into the manager (mutex must be held)
+void MemCache::StatsFold()
+{
+    m_Mgr->m_DeployedCount += m_Deployed;
+    m_Mgr->m_ReturnedCount += m_Returned;
+    m_Mgr->m_DeployedSize += m_DeployedSize;
+
+    m_Deployed = 0;
+    m_Returned = 0;
+    m_DeployedSize = 0;
+
+    // only the bins touched since the last fold are visited
+    for (uint32_t i = m_HistLo; i < m_HistHi; ++i)
+    {
+        m_Mgr->m_Hist[i] += m_Hist[i];
+        m_Hist[i] = 0;
+    }
+
+    m_HistLo = MemManager::k_HistBins;
+    m_HistHi = 0;
+}
+
+
+// ============================================================================
+// MemManager
+// ============================================================================
+
+
+// destructor
+MemManager::~MemManager()
+{
+    // the process-wide instance is never destructed (static initializer race condition)
+    MemPool *pPool = m_PoolHead;
+
+    // iterate through list and delete all pools
+    while (pPool != NULL)
+    {
+        m_PoolHead = pPool->NextGet();
+        delete pPool;
+        pPool = m_PoolHead;
+    }
+}
+
+
+// get a block of memory
+bool MemManager::MemBlockGet(MemBlock * &Mem, size_t Size)
+{
+    bool rv = true;
+    MemPool *pPool;
+    MemCache *pCache;
+    MemRegion *pRegion = MemRegion::BoundGet();
+
+    // a region bound to the calling thread serves requests to the process-wide instance
+    if ((pRegion != NULL) && (this == pInstance) && pRegion->MemBlockGet(Mem, Size))
+    {
+        return true;
+    }
+
+    pCache = CacheGet();
+
+    // most requests are served by the calling thread's cache
+    if ((pCache != NULL) && pCache->MemBlockGet(this, Mem, Size))
+    {
+        // mark for consistency and protection against multiple returns
+        Mem->GuardOn();
+        return true;
+    }
+
+    m_Mutex.Lock();
+
+    ++m_Hist[HistBinGet(Size)];
+
+    // find an appropriate pool
+    pPool = PoolGet(Size);
+
+    if (pPool != NULL)
+    {
+        // found a pool so attempt to get a block
+        rv = pPool->MemBlockGet(Mem);
+
+        if (rv)
+        {
+            // increment the block's usage count
+            Mem->UseCountInc();
+        }
+    }
+    else
+    {
+        // no appropriate pool, so allocate custom size block
+        char *pRaw = new (CP_NEW) char[Size + sizeof(MemBlock)];
+
+        if (pRaw != NULL)
+        {
+            Mem = new (pRaw) MemBlock(Size);
+            ++m_CustomGets;
+        }
+        else
+        {
+            rv = false;
+            LogErr << "MemManager::MemBlockGet(): Failed to allocate block of custom size: "
+                   << Size << std::endl;
+        }
+    }
+
+    // update statistics
+    if (rv)
+    {
+        ++m_DeployedCount;
+        m_DeployedSize += Mem->SizeGet();
+    }
+    else
+    {
+        ++m_FailedGets;
+    }
+
+    m_Mutex.Unlock();
+
+    // mark for consistency and protection against multiple returns
+    if (rv)
+    {
+        Mem->GuardOn();
+    }
+
+    return rv;
+}
+
+
+// return a block
+bool MemManager::MemBlockPut(MemBlock * &Mem)
+{
+    bool rv = true;
+    MemPool *pPool;
+    MemCache *pCache;
+    size_t size = 0;
+
+    // check validity of memory block
+    if (Mem == NULL)
+    {
+        return rv;
+    }
+    else
+    {
+        size = Mem->SizeGet();
+    }
+
+    // region blocks are recovered when their region is reset
+    if (Mem->Regional())
+    {
+        Mem->GuardOff();
+        return true;
+    }
+
+    // check for integrity and prevent multiple puts
+    if (Mem->Valid() == false)
+    {
+        LogErr << "MemManager::MemBlockPut(): Attempted return of invalid memory block: "
+               << Mem << std::endl;
+        return false;
+    }
+
+    // blocks are returned to the arena that owns them
+    pPool = Mem->PoolGet();
+
+    if ((pPool != NULL) && (pPool->ManagerGet() != this))
+    {
+        return pPool->ManagerGet()->MemBlockPut(Mem);
+    }
+
+    // remove integrity guard to prevent multiple return
+    Mem->GuardOff();
+
+    // most returns are absorbed by the calling thread's cache
+    pCache = CacheGet();
+
+    if ((pCache != NULL) && pCache->MemBlockPut(this, Mem))
+    {
+        return true;
+    }
+
+    m_Mutex.Lock();
+
+    if (pPool != NULL)
+    {
+        // return the block to its pool
+        rv = pPool->MemBlockPut(Mem);
+
+        if (rv)
+        {
+            m_ReleasedSize += pPool->Reclaim();
+        }
+    }
+    else
+    {
+        // no appropriate pool, so delete the custom size block
+        char *pRaw = reinterpret_cast<char *>(Mem);
+
+        if (pRaw != NULL)
+        {
+            delete [] pRaw;
+            Mem = NULL;
+        }
+    }
+
+    // update statistics
+    if (rv)
+    {
+        ++m_ReturnedCount;
+        m_DeployedSize -= size;
+    }
+    else
+    {
+        ++m_FailedPuts;
+    }
+
+    m_Mutex.Unlock();
+
+    return rv;
+}
+
+
+// return a block using its buffer pointer
+bool MemManager::MemBlockPut(char * &Mem)
+{
+    bool rv;
+
+    if (Mem == NULL)
+    {
+        return true;
+    }
+
+    // derive a pointer to where the header of the buffer should exist
+    MemBlock *pBlock = reinterpret_cast<MemBlock *>(Mem - sizeof(MemBlock));
+
+    // check for underflow
+    rv = (reinterpret_cast<size_t>(Mem) > reinterpret_cast<size_t>(pBlock));
+
+    // return the memory block
     if (rv)
     {
         rv = MemBlockPut(pBlock);
@@ -498,6 +1156,13 @@ bool MemManager::MemBlockPut(char * &Mem)
 void MemManager::StatusLog(std::ostream &Out, bool Blocks)
 {
     MemPool *pPool;
+    MemCache *pCache = CacheGet();
+
+    // bring the calling thread's statistics up to date
+    if (pCache != NULL)
+    {
+        pCache->Flush();
+    }
 
     if (m_Mutex.Lock())
     {
@@ -506,12 +1171,15 @@ void MemManager::StatusLog(std::ostream &Out, bool Blocks)
         Out << "Total Deployed:  " << m_DeployedCount << "  Returned:  "
             << m_ReturnedCount << "  Deployed Size:  " << m_DeployedSize << "\n";
         Out << "Failed Deploy Count:  " << m_FailedGets << "  Failed Return Count:  "
-            << m_FailedPuts << std::endl;
+            << m_FailedPuts << "\n";
+        Out << "Released Segment Size:  " << m_ReleasedSize << "  Heap Fall-through Count:  "
+            << m_CustomGets << std::endl;
 
         pPool = m_PoolHead;
 
         while (pPool != NULL)
         {
+            pPool->Collect();
             pPool->StatusLog(Out, Blocks);
             pPool = pPool->NextGet();
         }
@@ -522,7 +1190,7 @@ void MemManager::StatusLog(std::ostream &Out, bool Blocks)
 
 
 // create a new memory pool
-bool MemManager::CreatePool(size_t BlockSize, uint32_t Initial, uint32_t Increment)
+bool MemManager::CreatePool(size_t BlockSize, uint32_t Initial, uint32_t Increment, uint32_t HighWater, uint32_t Options)
 {
     bool rv = true;
 
@@ -556,10 +1224,18 @@ bool MemManager::CreatePool(size_t BlockSize, uint32_t Initial, uint32_t Increme
         pPool = pPool->NextGet();
     }
 
+    // enforce maximum number of pools
+    if (rv && (m_PoolCount == k_MaxPools))
+    {
+        rv = false;
+        LogErr << "MemManager::CreatePool(): Maximum number of pools reached, size: "
+               << BlockSize << std::endl;
+    }
+
     if (rv)
     {
         // create a new pool
-        pPool = new (CP_NEW) MemPool(BlockSize, Initial, Increment);
+        pPool = new (CP_NEW) MemPool(this, BlockSize, Initial, Increment, HighWater, Options);
 
         if (pPool == NULL)
         {
@@ -584,6 +1260,12 @@ bool MemManager::CreatePool(size_t BlockSize, uint32_t Initial, uint32_t Increme
             pPool->NextSet(pPrevMatch->NextGet());
             pPrevMatch->NextSet(pPool);
         }
+
+        // rebuild the lookup table
+        SizeClassBuild();
+
+        // invalidate thread cache snapshots
+        m_PoolGen.fetch_add(1, std::memory_order_release);
     }
 
     m_Mutex.Unlock();
@@ -592,12 +1274,375 @@ bool MemManager::CreatePool(size_t BlockSize, uint32_t Initial, uint32_t Increme
 }
 
 
-// get singleton instance
+// set a pool's reclamation threshold
+bool MemManager::HighWaterSet(size_t BlockSize, uint32_t HighWater)
+{
+    bool rv;
+    MemPool *pPool;
+
+    m_Mutex.Lock();
+
+    // the pool must match the block size exactly
+    pPool = PoolGet(BlockSize);
+    rv = ((pPool != NULL) && (pPool->SizeGet() == BlockSize));
+
+    if (rv)
+    {
+        pPool->HighWaterSet(HighWater);
+        m_ReleasedSize += pPool->Reclaim();
+    }
+
+    m_Mutex.Unlock();
+
+    return rv;
+}
+
+
+// release idle segments of all pools
+size_t MemManager::Trim()
+{
+    size_t released = 0;
+    MemCache *pCache = CacheGet();
+
+    // blocks held by the calling thread's cache are returned first
+    if (pCache != NULL)
+    {
+        pCache->Flush();
+    }
+
+    m_Mutex.Lock();
+
+    for (uint32_t i = 0; i < m_PoolCount; ++i)
+    {
+        released += m_Pools[i]->Trim();
+    }
+
+    m_ReleasedSize += released;
+
+    m_Mutex.Unlock();
+
+    return released;
+}
+
+
+// log the request size histogram
+void MemManager::HistogramLog(std::ostream &Out)
+{
+    MemCache *pCache = CacheGet();
+
+    // bring the calling thread's counts up to date
+    if (pCache != NULL)
+    {
+        pCache->Flush();
+    }
+
+    m_Mutex.Lock();
+
+    Out << "\nMemManager Request Histogram\n";
+    Out << "----------------------------\n";
+
+    for (uint32_t i = 0; i < k_HistBins; ++i)
+    {
+        if (m_Hist[i] > 0)
+        {
+            MemPool *pPool = PoolGet(HistBinSize(i));
+
+            Out << "  Size <=  " << std::setw(10) << HistBinSize(i)
+                << "  Requests:  " << std::setw(10) << m_Hist[i]
+                << "  Pool:  ";
+
+            if (pPool != NULL)
+            {
+                Out << std::setw(10) << pPool->SizeGet() << std::endl;
+            }
+            else
+            {
+                Out << std::setw(10) << "heap" << std::endl;
+            }
+        }
+    }
+
+    m_Mutex.Unlock();
+}
+
+
+// reset the request size histogram
+void MemManager::HistogramClear()
+{
+    MemCache *pCache = CacheGet();
+
+    if (pCache != NULL)
+    {
+        pCache->Flush();
+    }
+
+    m_Mutex.Lock();
+    memset(m_Hist, 0, sizeof(m_Hist));
+    m_CustomGets = 0;
+    m_Mutex.Unlock();
+}
+
+
+// propose pools from the request size histogram
+uint32_t MemManager::Recommend(PoolSpec *Specs, uint32_t MaxPools, size_t MaxBlockSize)
+{
+    std::vector<size_t> size;
+    std::vector<uint64_t> count;
+    std::vector<PoolSpec> current;
+    MemCache *pCache = CacheGet();
+    uint32_t n;
+    uint32_t k;
+
+    if (MaxPools > k_MaxPools)
+    {
+        MaxPools = k_MaxPools;
+    }
+
+    // counts held by other threads' caches are folded on their next refill
+    if (pCache != NULL)
+    {
+        pCache->Flush();
+    }
+
+    m_Mutex.Lock();
+
+    // gather the observed request sizes as pointer aligned block sizes no smaller than the minimum
+    for (uint32_t i = 0; i < k_HistBins; ++i)
+    {
+        size_t binSize = (HistBinSize(i) + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+        if (binSize < k_MinMemBlockSize)
+        {
+            binSize = k_MinMemBlockSize;
+        }
+
+        if ((m_Hist[i] == 0) || (binSize > MaxBlockSize))
+        {
+            continue;
+        }
+
+        if ((size.size() > 0) && (size.back() == binSize))
+        {
+            count.back() += m_Hist[i];
+        }
+        else
+        {
+            size.push_back(binSize);
+            count.push_back(m_Hist[i]);
+        }
+    }
+
+    // remember the current pools so their sizing carries over
+    for (uint32_t i = 0; i < m_PoolCount; ++i)
+    {
+        PoolSpec spec;
+
+        spec.m_BlockSize = m_Pools[i]->SizeGet();
+        spec.m_Initial = m_Pools[i]->PeakGet();
+        spec.m_Increment = m_Pools[i]->IncrementGet();
+        spec.m_HighWater = m_Pools[i]->HighWaterGet();
+        spec.m_Options = m_Pools[i]->OptionsGet();
+        current.push_back(spec);
+    }
+
+    m_Mutex.Unlock();
+
+    n = static_cast<uint32_t>(size.size());
+    k = (MaxPools < n) ? MaxPools : n;
+
+    if (k == 0)
+    {
+        return 0;
+    }
+
+    // prefix sums give the waste of serving sizes i..j from a pool of size[j] in constant time
+    std::vector<uint64_t> sumCount(n + 1, 0);
+    std::vector<uint64_t> sumBytes(n + 1, 0);
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        sumCount[i + 1] = sumCount[i] + count[i];
+        sumBytes[i + 1] = sumBytes[i] + count[i] * size[i];
+    }
+
+    // best[p * n + j] is the least waste covering sizes 0..j with p + 1 pools, the largest being size[j]
+    std::vector<uint64_t> best(k * n, ~uint64_t(0));
+    std::vector<uint32_t> from(k * n, 0);
+
+    for (uint32_t j = 0; j < n; ++j)
+    {
+        best[j] = size[j] * sumCount[j + 1] - sumBytes[j + 1];
+    }
+
+    for (uint32_t p = 1; p < k; ++p)
+    {
+        for (uint32_t j = p; j < n; ++j)
+        {
+            for (uint32_t i = p; i <= j; ++i)
+            {
+                uint64_t waste = best[(p - 1) * n + (i - 1)] +
+                                 size[j] * (sumCount[j + 1] - sumCount[i]) - (sumBytes[j + 1] - sumBytes[i]);
+
+                if (waste < best[p * n + j])
+                {
+                    best[p * n + j] = waste;
+                    from[p * n + j] = i;
+                }
+            }
+        }
+    }
+
+    // the largest observed size always ends a pool, so nothing falls through to the heap
+    uint32_t j = n - 1;
+
+    for (uint32_t p = k; p > 0; --p)
+    {
+        PoolSpec &spec = Specs[p - 1];
+        uint32_t root = 1;
+
+        // default increment follows the standard pools (1024 / sqrt(block size))
+        while (((root + 1) * (root + 1)) <= size[j])
+        {
+            ++root;
+        }
+
+        spec.m_BlockSize = size[j];
+        spec.m_Increment = (1024 / root < 4) ? 4 : (1024 / root);
+        spec.m_Initial = spec.m_Increment;
+        spec.m_HighWater = 0;
+        spec.m_Options = MemPool::opt_Heap;
+
+        // an existing pool of the same size keeps its settings and starts at its peak usage
+        for (size_t c = 0; c < current.size(); ++c)
+        {
+            if (current[c].m_BlockSize == spec.m_BlockSize)
+            {
+                spec.m_Increment = current[c].m_Increment;
+                spec.m_Initial = (current[c].m_Initial > spec.m_Increment) ? current[c].m_Initial : spec.m_Increment;
+                spec.m_HighWater = current[c].m_HighWater;
+                spec.m_Options = current[c].m_Options;
+            }
+        }
+
+        j = from[(p - 1) * n + j] - 1;
+    }
+
+    return k;
+}
+
+
+// create proposed pools that do not exist
+uint32_t MemManager::Tune(uint32_t MaxPools, size_t MaxBlockSize)
+{
+    PoolSpec specs[k_MaxPools];
+    uint32_t count = Recommend(specs, MaxPools, MaxBlockSize);
+    uint32_t created = 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (CreatePool(specs[i].m_BlockSize,
+                       specs[i].m_Initial,
+                       specs[i].m_Increment,
+                       specs[i].m_HighWater,
+                       specs[i].m_Options))
+        {
+            ++created;
+        }
+    }
+
+    return created;
+}
+
+
+// write proposed pools to a configuration file
+bool MemManager::ConfigSave(char const *Path, uint32_t MaxPools, size_t MaxBlockSize)
+{
+    PoolSpec specs[k_MaxPools];
+    uint32_t count = Recommend(specs, MaxPools, MaxBlockSize);
+    std::ofstream cfgFile(Path);
+
+    if (!cfgFile)
+    {
+        LogErr << "MemManager::ConfigSave(): Failed to open file: " << Path << std::endl;
+        return false;
+    }
+
+    cfgFile << "# MemManager pool configuration\n";
+    cfgFile << "# pool  BlockSize  Initial  Increment  HighWater  Options\n";
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        cfgFile << "pool  " << specs[i].m_BlockSize
+                << "  "     << specs[i].m_Initial
+                << "  "     << specs[i].m_Increment
+                << "  "     << specs[i].m_HighWater
+                << "  "     << specs[i].m_Options << "\n";
+    }
+
+    return cfgFile.good();
+}
+
+
+// create pools listed in a configuration file
+bool MemManager::ConfigLoad(char const *Path)
+{
+    bool rv = true;
+    std::ifstream cfgFile(Path);
+    std::string line;
+
+    if (!cfgFile)
+    {
+        LogErr << "MemManager::ConfigLoad(): Failed to open file: " << Path << std::endl;
+        return false;
+    }
+
+    while (std::getline(cfgFile, line))
+    {
+        std::istringstream fields(line);
+        std::string keyword;
+        PoolSpec spec;
+
+        // skip blank lines, comments and unknown keywords
+        if (!(fields >> keyword) || (keyword != "pool"))
+        {
+            continue;
+        }
+
+        if (!(fields >> spec.m_BlockSize >> spec.m_Initial >> spec.m_Increment
+                     >> spec.m_HighWater >> spec.m_Options))
+        {
+            LogErr << "MemManager::ConfigLoad(): Malformed line: " << line << std::endl;
+            rv = false;
+            continue;
+        }
+
+        // pools that already exist keep their settings
+        m_Mutex.Lock();
+        MemPool *pPool = PoolGet(spec.m_BlockSize);
+        bool exists = ((pPool != NULL) && (pPool->SizeGet() == spec.m_BlockSize));
+        m_Mutex.Unlock();
+
+        if (exists)
+        {
+            HighWaterSet(spec.m_BlockSize, spec.m_HighWater);
+        }
+        else if (CreatePool(spec.m_BlockSize, spec.m_Initial, spec.m_Increment,
+                            spec.m_HighWater, spec.m_Options) == false)
+        {
+            rv = false;
+        }
+    }
+
+    return rv;
+}
+
+
+// get process-wide instance
 MemManager *MemManager::InstanceGet()
 {
     if (pInstance == NULL)
     {
-        pInstance = new (CP_NEW) MemManager;
+        pInstance = new (CP_NEW) MemManager(true);
 
         if (pInstance == NULL)
         {
@@ -610,43 +1655,130 @@ MemManager *MemManager::InstanceGet()
 }
 
 
+// return the calling thread's cache if it applies
+MemCache *MemManager::CacheGet()
+{
+    // independent arenas keep to their own lock domain
+    return (this == pInstance) ? MemCache::InstanceGet() : NULL;
+}
+
+
 // return a pool of sufficient block size
 MemPool *MemManager::PoolGet(size_t BlockSize)
+{
+    uint32_t i = m_SizeClass[SizeClassGet(BlockSize)];
+
+    // at most the pools sharing this size class are examined
+    while ((i < m_PoolCount) && (m_Pools[i]->SizeGet() < BlockSize))
+    {
+        ++i;
+    }
+
+    return (i < m_PoolCount) ? m_Pools[i] : NULL;
+}
+
+
+// rebuild pool index and size class table
+void MemManager::SizeClassBuild()
 {
     MemPool *pPool = m_PoolHead;
-    MemPool *pBestMatch = NULL;
+    uint32_t i = 0;
+
+    // index the pools in ascending block size order
+    m_PoolCount = 0;
 
     while (pPool != NULL)
     {
-        if (pPool->SizeGet() >= BlockSize)
+        m_Pools[m_PoolCount++] = pPool;
+        pPool = pPool->NextGet();
+    }
+
+    // each size class starts at the first pool able to hold its smallest request
+    for (uint32_t sc = 0; sc < k_SizeClasses; ++sc)
+    {
+        uint64_t lowest = (sc == 0) ? 0 : (uint64_t(1) << (sc - 1)) + 1;
+
+        while ((i < m_PoolCount) && (m_Pools[i]->SizeGet() < lowest))
         {
-            pBestMatch = pPool;
-            break;
+            ++i;
         }
 
-        // go to next pool, if any
-        pPool = pPool->NextGet();
+        m_SizeClass[sc] = static_cast<uint8_t>(i);
     }
+}
+
+
+// return the log2 size class of a request (number of significant bits in Size - 1)
+uint32_t MemManager::SizeClassGet(size_t Size)
+{
+    uint64_t val = (Size > 0) ? (Size - 1) : 0;
+    uint32_t sc = 0;
+
+    if (val >> 32) { val >>= 32; sc += 32; }
+    if (val >> 16) { val >>= 16; sc += 16; }
+    if (val >>  8) { val >>=  8; sc +=  8; }
+    if (val >>  4) { val >>=  4; sc +=  4; }
+    if (val >>  2) { val >>=  2; sc +=  2; }
+    if (val >>  1) { val >>=  1; sc +=  1; }
 
-    return pBestMatch;
+    return sc + static_cast<uint32_t>(val);
 }
 
 
-// private constructor (for singleton pattern)
-MemManager::MemManager() :
+// return the histogram bin of a request (each size class is split into four bins)
+uint32_t MemManager::HistBinGet(size_t Size)
+{
+    uint32_t sc = SizeClassGet(Size);
+
+    if (sc < 3)
+    {
+        return sc * 4;
+    }
+
+    return (sc * 4) + static_cast<uint32_t>(((uint64_t(Size) - 1) >> (sc - 3)) & 3);
+}
+
+
+// return the largest request counted in a bin
+size_t MemManager::HistBinSize(uint32_t Bin)
+{
+    uint32_t sc = Bin / 4;
+    uint64_t sub = Bin % 4;
+
+    if (sc < 3)
+    {
+        return size_t(1) << sc;
+    }
+
+    return static_cast<size_t>((uint64_t(1) << (sc - 1)) + ((sub + 1) << (sc - 3)));
+}
+
+
+// constructor
+MemManager::MemManager(bool DefaultPools) :
     m_DeployedCount(0),
     m_ReturnedCount(0),
     m_FailedGets(0),
     m_FailedPuts(0),
     m_DeployedSize(0),
-    m_PoolHead(NULL)
-{
-    CreatePool(16,   256,  256);        //   4KB
-    CreatePool(64,   128,  128);        //   8KB
-    CreatePool(256,   64,   64);        //  16KB
-    CreatePool(1024,  32,   32);        //  32KB
-    CreatePool(4096,  16,   16);        //  64KB
-    CreatePool(16384,  8,    8);        // 128KB
+    m_ReleasedSize(0),
+    m_CustomGets(0),
+    m_PoolHead(NULL),
+    m_PoolCount(0),
+    m_PoolGen(0)
+{
+    memset(m_Hist, 0, sizeof(m_Hist));
+    SizeClassBuild();
+
+    if (DefaultPools)
+    {
+        CreatePool(16,   256,  256);    //   4KB
+        CreatePool(64,   128,  128);    //   8KB
+        CreatePool(256,   64,   64);    //  16KB
+        CreatePool(1024,  32,   32);    //  32KB
+        CreatePool(4096,  16,   16);    //  64KB
+        CreatePool(16384,  8,    8);    // 128KB
+    }
 }
 
 }   // namespace cp
@@ -15,11 +15,23 @@
 //  2010-10-10  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2023-03-28  asc Added parameter to control block level details in StatusLog().
+//  2026-10-16  asc Added per-thread block cache (MemCache) in front of the pools.
+//  2026-10-16  asc Added size class lookup table and owning pool in MemBlock header.
+//  2026-10-16  asc Added segment occupancy tracking, Trim() and pool high-water limit.
+//  2026-10-16  asc Added mapped and huge page segment provider options.
+//  2026-10-16  asc Added lock-free return stack to MemPool for cache drains.
+//  2026-10-16  asc Added LIFO block reuse option.
+//  2026-10-16  asc Allowed independently constructed MemManager arenas.
+//  2026-10-16  asc Added region block sentinel to MemBlock.
+//  2026-10-16  asc Added request size histogram and pool configuration tuning.
+//  2026-10-16  asc Added owner reference count to MemBlock for shared buffers.
 // ----------------------------------------------------------------------------
 
 #ifndef  CP_MEMMGR_H
 #define  CP_MEMMGR_H
 
+#include <atomic>
+
 #include "cpPlatform.h"
 #include "cpMemMutex_I.h"
 
@@ -31,18 +43,56 @@
 // appropriate pool which looks in its inventory of memory segments to find
 // one that has a free block available.  If no free blocks are found, a new
 // segment is allocated and a memory block is returned.
+//
+// To keep the manager's mutex off the common path, each thread has a cache
+// that holds a small magazine of free blocks per pool.  Gets and puts are
+// served from the magazine without locking.  Magazines are refilled from their
+// pools in batches under the mutex, and drained in batches onto a lock-free
+// return stack in each pool, so blocks freed on a different thread than the
+// one that allocated them never wait for the mutex.  The return stack is only
+// pushed or detached as a whole, which makes it immune to the ABA problem.
+//
+// Each segment tracks how many of its blocks are in the pool's inventory.  A
+// segment whose blocks are all free (other than a pool's initial segment) is
+// idle and can be released back to the heap, either explicitly through
+// MemManager::Trim() or when a pool's inventory exceeds its high-water limit.
+//
+// Besides the process-wide instance, managers may be constructed as separate
+// arenas with their own pools and mutex.  Every pool knows its manager, so a
+// block returned through any manager is forwarded to the arena that owns it.
+// Thread caches only front the process-wide instance.
+//
+// Blocks carved from a MemRegion carry their own sentinel and are ignored when
+// returned.  While a region is bound to a thread, that thread's requests to
+// the process-wide instance are served from the region (see cpMemRegion.h).
+//
+// The manager keeps a histogram of requested sizes in quarter-octave bins.
+// From it, Recommend() proposes a set of pool sizes that minimizes the bytes
+// wasted rounding requests up to a block size, covering every observed size
+// up to a limit so requests stop falling through to the heap.  Tune() creates
+// the proposed pools that do not exist yet, and ConfigSave() writes them to a
+// file that ConfigLoad() applies at the next process start.
+//
+// Segments normally come from the heap.  A pool may instead map its segments
+// from anonymous pages, optionally huge pages, and prefault them or lock its
+// initial segment in memory so steady-state traffic does not take page faults.
 // ----------------------------------------------------------------------------
 
 namespace cp
 {
 
+class MemPool;
+class MemSegment;
+class MemManager;
+class MemCache;
+
 // Memory Block - This represents a unit of memory delivered to the client.
 //
 class MemBlock
 {
 public:
     // constructor
-    MemBlock(size_t BlockSize);
+    MemBlock(size_t BlockSize, MemSegment *Seg = NULL);
 
     // destructor
     ~MemBlock();
@@ -53,6 +103,11 @@ public:
         return (m_Guard == k_MemSentinel);
     }
 
+    bool Regional() const                                   // determine if block was carved from a MemRegion
+    {
+        return (m_Guard == k_RegionSentinel);
+    }
+
     char *BuffGet() const                                   // accessor for data buffer
     {
         return ((char *)this) + sizeof(MemBlock);
@@ -63,6 +118,13 @@ public:
         return m_BlockSize;
     }
 
+    MemSegment *SegmentGet() const                          // accessor for owning segment (NULL if custom size)
+    {
+        return m_Segment;
+    }
+
+    MemPool *PoolGet() const;                               // accessor for owning pool (NULL if custom size)
+
     void StatusLog(std::ostream &Out) const;                // log block usage statistics
 
     // manipulators
@@ -72,6 +134,8 @@ public:
 
     void GuardOff() { m_Guard = 0; }                        // deactivate sentinel
 
+    void GuardRegion() { m_Guard = k_RegionSentinel; }      // activate region sentinel
+
     void UseCountInc()                                      // increment the usage counter
     {
         if (++m_UseCount == 0)
@@ -80,6 +144,27 @@ public:
         }
     }
 
+    // owner reference count (maintained by clients that share a block, such as Buffer)
+    uint32_t RefGet() const                                 // get the number of owners
+    {
+        return m_RefCount.load(std::memory_order_acquire);
+    }
+
+    void RefSet(uint32_t Count)                             // set the number of owners of an unshared block
+    {
+        m_RefCount.store(Count, std::memory_order_relaxed);
+    }
+
+    void RefInc()                                           // add an owner
+    {
+        m_RefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t RefDec()                                       // remove an owner and return the number remaining
+    {
+        return m_RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+
     // embedded list accessors
     void NextSet(MemBlock *Blk)                             // put pointer to next block in the list
     {
@@ -94,7 +179,9 @@ public:
 private:
     uint16_t            m_Guard;                            // guard sentinel to detect memory corruption
     uint16_t            m_UseCount;                         // counts number of times this block has been deployed
+    std::atomic<uint32_t> m_RefCount;                       // number of owners sharing the block
     size_t              m_BlockSize;                        // the size of the data buffer
+    MemSegment         *m_Segment;                          // the segment that holds this block
 };
 
 //-----------------------------------------------------------------------------
@@ -106,9 +193,48 @@ private:
 class MemSegment
 {
 public:
-    MemSegment();
+    MemSegment(MemPool *Pool, uint32_t Blocks, bool Pinned, size_t MapSize);
     ~MemSegment();
 
+    // accessor methods
+    MemPool *PoolGet() const                                // accessor for owning pool
+    {
+        return m_Pool;
+    }
+
+    uint32_t CountGet() const                               // accessor for number of blocks in the segment
+    {
+        return m_Count;
+    }
+
+    size_t MapSizeGet() const                               // accessor for mapped size (0 if from heap)
+    {
+        return m_MapSize;
+    }
+
+    bool Idle() const                                       // determine if segment can be released
+    {
+        return (m_Pinned == false) && (m_Free == m_Count);
+    }
+
+    bool ReclaimGet() const                                 // determine if segment is selected for release
+    {
+        return m_Reclaim;
+    }
+
+    // manipulators
+    bool FreeInc()                                          // count a returned block, true if segment became idle
+    {
+        return (++m_Free == m_Count) && (m_Pinned == false);
+    }
+
+    bool FreeDec()                                          // count a deployed block, true if segment was idle
+    {
+        return (m_Free-- == m_Count) && (m_Pinned == false);
+    }
+
+    void ReclaimSet(bool State) { m_Reclaim = State; }      // select or deselect segment for release
+
     // embedded list accessors
     void NextSet(MemSegment *Seg)                           // set pointer to next segment in the list
     {
@@ -122,10 +248,24 @@ public:
 
 private:
     MemSegment         *m_Next;                             // pointer to next segment in list
+    MemPool            *m_Pool;                             // the pool that owns this segment
+    uint32_t            m_Count;                            // number of blocks in the segment
+    uint32_t            m_Free;                             // number of blocks in the pool's inventory
+    size_t              m_MapSize;                          // size of the page mapping (0 if from heap)
+    bool                m_Pinned;                           // true for a pool's initial segment
+    bool                m_Reclaim;                          // true while selected for release
 };
 
 //-----------------------------------------------------------------------------
 
+// accessor for owning pool (NULL if custom size)
+inline MemPool *MemBlock::PoolGet() const
+{
+    return (m_Segment != NULL) ? m_Segment->PoolGet() : NULL;
+}
+
+//-----------------------------------------------------------------------------
+
 // Memory Pool - This represents a collection of one or more segments from which memory blocks are
 //               distributed to a client.  A given pool is characterized by a uniform memory
 //               block size and is owned by the memory manager.  The manager delegates block
@@ -134,10 +274,24 @@ private:
 class MemPool
 {
 public:
+    // local enumerations
+    enum Options
+    {
+        opt_Heap     = 0x00,                                // segments are allocated from the heap
+        opt_Mapped   = 0x01,                                // segments are mapped from anonymous pages
+        opt_HugePage = 0x02,                                // mapped segments use huge pages when available
+        opt_Prefault = 0x04,                                // mapped segments are touched when created
+        opt_Lock     = 0x08,                                // the mapped initial segment is locked in memory
+        opt_Lifo     = 0x10                                 // the most recently returned block is reused first
+    };
+
     // constructor
-    MemPool(size_t BlockSize,
+    MemPool(MemManager *Mgr,
+              size_t BlockSize,
               uint32_t InitCount,
-              uint32_t Increment);
+              uint32_t Increment,
+              uint32_t HighWater = 0,
+              uint32_t Options = opt_Heap);
 
     // destructor
     ~MemPool();
@@ -151,8 +305,48 @@ public:
         return m_BlockSize;
     }
 
+    uint32_t IncrementGet()                                 // get the number of blocks added per segment
+    {
+        return m_Increment;
+    }
+
+    MemManager *ManagerGet() const                          // get the manager that owns this pool
+    {
+        return m_Mgr;
+    }
+
     void StatusLog(std::ostream &Out, bool Blocks) const;   // log block usage statistics
 
+    // manipulators
+    size_t Trim(uint32_t Target = 0);                       // release idle segments down to an inventory target
+    size_t Reclaim();                                       // release idle segments above the high-water limit
+
+    void MemBlockPush(MemBlock *First,
+                      MemBlock *Last,
+                      uint32_t Count);                      // return a chain of blocks without locking
+    uint32_t Collect();                                     // move pushed blocks into the inventory
+
+    uint32_t PushedGet() const                              // get number of blocks waiting to be collected
+    {
+        return m_PushCount.load(std::memory_order_relaxed);
+    }
+
+    uint32_t HighWaterGet() const                           // get inventory level that triggers reclamation
+    {
+        return m_HighWater;
+    }
+
+    void HighWaterSet(uint32_t HighWater)                   // set inventory level that triggers reclamation
+    {
+        m_HighWater = HighWater;
+    }
+
+    uint32_t PeakGet() const { return m_PeakUsed; }         // get the peak number of blocks in use
+
+    uint32_t OptionsGet() const { return m_Options; }       // get the segment provider options
+
+    void CachedAdd(uint32_t Count) { m_Cached += Count; }   // account for blocks moved into a thread cache
+
     // embedded list accessors
     void NextSet(MemPool *Pool)                             // put pointer to next pool in the list
     {
@@ -165,16 +359,33 @@ public:
     }
 
 private:
-    bool AllocateSegment(uint32_t NumBlocks);               // allocate another memory segment
+    bool AllocateSegment(uint32_t NumBlocks,
+                         bool Pinned = false);              // allocate another memory segment
 
+    void ReleaseSegment(MemSegment *Seg);                   // return a segment's memory to the system
+
+    size_t SegmentSize(uint32_t NumBlocks) const            // size of a segment holding a number of blocks
+    {
+        return (NumBlocks * (m_BlockSize + sizeof(MemBlock))) + sizeof(MemSegment);
+    }
+
+    MemManager         *m_Mgr;                              // the manager that owns this pool
     size_t              m_BlockSize;                        // the size of the pooled memory blocks
     uint32_t            m_Increment;                        // number of blocks a subsequently allocated segment must hold
     uint32_t            m_TotalBlocks;                      // total number of blocks managed by this pool
     uint32_t            m_Inventory;                        // total number of unused blocks current in inventory
     uint32_t            m_PeakUsed;                         // highest number of blocks ever deployed
+    uint32_t            m_Cached;                           // number of blocks held in thread caches
+    uint32_t            m_HighWater;                        // inventory level that triggers reclamation (0 = none)
+    uint32_t            m_Options;                          // segment provider and reuse options
+    uint32_t            m_SegCount;                         // number of allocated segments
+    uint32_t            m_IdleSegs;                         // number of segments that can be released
+    uint32_t            m_Released;                         // cumulative number of segments released
     MemSegment         *m_SegHead;                          // list of allocated segments
     MemBlock           *m_BlkHead;                          // first entry in block inventory
     MemBlock           *m_BlkTail;                          // last entry in block inventory
+    std::atomic<MemBlock *> m_PushHead;                     // lock-free stack of returned blocks
+    std::atomic<uint32_t> m_PushCount;                      // number of blocks on the returned stack
     MemPool            *m_Next;                             // pointer to next pool in list
 };
 
@@ -193,7 +404,20 @@ private:
 class MemManager
 {
 public:
-    // destructor
+    // pool parameters proposed from the request size histogram
+    struct PoolSpec
+    {
+        size_t          m_BlockSize;                        // block size
+        uint32_t        m_Initial;                          // blocks in the initial segment
+        uint32_t        m_Increment;                        // blocks added per segment
+        uint32_t        m_HighWater;                        // inventory level that triggers reclamation
+        uint32_t        m_Options;                          // segment provider options
+    };
+
+    // constructor (for independent arenas)
+    explicit MemManager(bool DefaultPools = true);
+
+    // destructor (all blocks must have been returned)
     ~MemManager();
 
     // accessors
@@ -202,30 +426,127 @@ public:
     bool MemBlockPut(char * &Mem);                          // return a block using its buffer pointer
 
     void StatusLog(std::ostream &Out, bool Blocks = false); // get block usage statistics
+    void HistogramLog(std::ostream &Out);                   // log the request size histogram
+
+    uint32_t Recommend(PoolSpec *Specs,
+                       uint32_t MaxPools,
+                       size_t MaxBlockSize = k_MaxTuneSize); // propose pools from the request size histogram
 
     // manipulators
     bool CreatePool(size_t BlockSize,
                     uint32_t InitCount,
-                    uint32_t Increment);                    // create a new memory pool
+                    uint32_t Increment,
+                    uint32_t HighWater = 0,
+                    uint32_t Options = MemPool::opt_Heap);  // create a new memory pool
+
+    bool HighWaterSet(size_t BlockSize, uint32_t HighWater); // set a pool's reclamation threshold
+    size_t Trim();                                          // release idle segments of all pools
+    void HistogramClear();                                  // reset the request size histogram
+
+    uint32_t Tune(uint32_t MaxPools,
+                  size_t MaxBlockSize = k_MaxTuneSize);     // create proposed pools that do not exist
+
+    bool ConfigSave(char const *Path,
+                    uint32_t MaxPools,
+                    size_t MaxBlockSize = k_MaxTuneSize);   // write proposed pools to a configuration file
+
+    bool ConfigLoad(char const *Path);                      // create pools listed in a configuration file
 
     // static accessors
-    static MemManager *InstanceGet();                       // static accessor of singleton
+    static MemManager *InstanceGet();                       // static accessor of process-wide instance
 
 private:
-    // private constructor (for singleton pattern)
-    MemManager();
+    friend class MemCache;
+
+    // local enumerations
+    enum Constants { k_MaxPools = 64, k_SizeClasses = 65, k_HistBins = k_SizeClasses * 4, k_MaxTuneSize = 1048576 };
+
+    MemCache *CacheGet();                                   // return the calling thread's cache if it applies
     MemPool *PoolGet(size_t BlockSize);                     // return a pool of sufficient block size
+    void SizeClassBuild();                                  // rebuild pool index and size class table
+
+    // static helpers
+    static uint32_t SizeClassGet(size_t Size);              // return the log2 size class of a request
+    static uint32_t HistBinGet(size_t Size);                // return the histogram bin of a request
+    static size_t HistBinSize(uint32_t Bin);                // return the largest request counted in a bin
 
     uint32_t            m_DeployedCount;                    // cumulative number of buffers deployed
     uint32_t            m_ReturnedCount;                    // cumulative number of buffers returned
     uint32_t            m_FailedGets;                       // cumulative number of failed get requests
     uint32_t            m_FailedPuts;                       // cumulative number of failed put requests
     uint32_t            m_DeployedSize;                     // number of bytes currently deployed
+    size_t              m_ReleasedSize;                     // cumulative number of segment bytes released
+    uint32_t            m_CustomGets;                       // cumulative number of requests served by the heap
     MemPool            *m_PoolHead;                         // list of memory pools
+    uint32_t            m_PoolCount;                        // number of memory pools
+    MemPool            *m_Pools[k_MaxPools];                // pools in ascending block size order
+    uint8_t             m_SizeClass[k_SizeClasses];         // index of first pool for each size class
     MemMutex            m_Mutex;                            // thread protection mutex
+    std::atomic<uint32_t> m_PoolGen;                        // incremented each time a pool is created
+    uint64_t            m_Hist[k_HistBins];                 // number of requests per size bin
 
     // static member data
-    static MemManager *pInstance;                           // static singleton instance
+    static MemManager *pInstance;                           // static process-wide instance
+};
+
+//-----------------------------------------------------------------------------
+
+// Memory Cache - This is a per-thread front end to the memory manager.  It holds a
+//                magazine of free blocks for each pool so that most requests and
+//                returns complete without taking the manager's mutex.  An empty
+//                magazine is refilled with half its depth from the pool, and a full
+//                one drains half its depth back.  Deployment statistics are kept
+//                locally and folded into the manager whenever the mutex is taken.
+class MemCache
+{
+public:
+    // constructor
+    MemCache();
+
+    // destructor
+    ~MemCache();
+
+    // accessors
+    bool MemBlockGet(MemManager *Mgr, MemBlock * &Mem, size_t Size);   // get a block from the cache
+    bool MemBlockPut(MemManager *Mgr, MemBlock * &Mem);                 // return a block to the cache
+
+    // manipulators
+    void Flush();                                           // return all cached blocks and statistics
+
+    // static accessors
+    static MemCache *InstanceGet();                         // accessor of the calling thread's cache
+
+private:
+    // local enumerations
+    enum Constants { k_MaxPools = 32, k_MaxDepth = 32 };
+
+    // free blocks of a single pool
+    struct Magazine
+    {
+        MemPool        *m_Pool;                             // pool that owns the blocks
+        size_t          m_Size;                             // block size of the pool
+        uint32_t        m_Depth;                            // maximum number of blocks held
+        uint32_t        m_Count;                            // number of blocks currently held
+        MemBlock       *m_Blocks[k_MaxDepth];               // stack of free blocks
+    };
+
+    bool Bind(MemManager *Mgr);                             // attach to a manager and snapshot its pools
+    Magazine *MagazineGet(size_t Size);                     // return the magazine of sufficient block size
+    bool Refill(Magazine &Mag);                             // withdraw a batch of blocks from the pool
+    void Drain(Magazine &Mag, uint32_t Count);              // push the oldest blocks back to the pool
+    void StatsFold();                                       // fold local statistics into the manager
+
+    MemManager         *m_Mgr;                              // manager this cache is bound to
+    uint32_t            m_PoolGen;                          // manager pool generation of the snapshot
+    uint32_t            m_PoolCount;                        // number of magazines in use
+    uint8_t             m_SizeClass[MemManager::k_SizeClasses]; // index of first magazine for each size class
+    uint32_t            m_Deployed;                         // blocks deployed since last fold
+    uint32_t            m_Returned;                         // blocks returned since last fold
+    uint32_t            m_DeployedSize;                     // change in deployed bytes since last fold
+    uint32_t            m_HistLo;                           // lowest histogram bin touched since last fold
+    uint32_t            m_HistHi;                           // one past the highest bin touched since last fold
+    uint32_t            m_Hist[MemManager::k_HistBins];     // requests per size bin since last fold
+    Magazine            m_Mag[k_MaxPools];                  // magazines in ascending block size order
 };
 
 //-----------------------------------------------------------------------------
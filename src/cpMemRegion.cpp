@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpMemRegion.cpp
+//
+//  Description:    Monotonic Memory Region.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#include <new>
+
+#include "cpMemRegion.h"
+
+namespace cp
+{
+
+// region bound to each thread
+thread_local MemRegion *MemRegion::m_PtrBound = NULL;
+
+// ----------------------------------------------------------------------------
+
+// constructor
+MemRegion::Scope::Scope(MemRegion &Region) :
+    m_Prev(MemRegion::m_PtrBound)
+{
+    MemRegion::m_PtrBound = &Region;
+}
+
+
+// destructor
+MemRegion::Scope::~Scope()
+{
+    MemRegion::m_PtrBound = m_Prev;
+}
+
+
+// constructor
+MemRegion::Suspend::Suspend() :
+    m_Prev(MemRegion::m_PtrBound)
+{
+    MemRegion::m_PtrBound = NULL;
+}
+
+
+// destructor
+MemRegion::Suspend::~Suspend()
+{
+    MemRegion::m_PtrBound = m_Prev;
+}
+
+// ----------------------------------------------------------------------------
+
+// constructor
+MemRegion::MemRegion(size_t ChunkSize, MemManager *Mgr) :
+    m_Mgr(Mgr ? Mgr : MemManager::InstanceGet()),
+    m_ChunkSize(ChunkSize),
+    m_ChunkCount(0),
+    m_Used(0),
+    m_Count(0),
+    m_Chunks(NULL),
+    m_Current(NULL),
+    m_Cursor(NULL),
+    m_Limit(NULL)
+{
+}
+
+
+// destructor
+MemRegion::~MemRegion()
+{
+    Release();
+}
+
+
+// get a block of memory from the region
+bool MemRegion::MemBlockGet(MemBlock * &Mem, size_t Size)
+{
+    char *pRaw;
+
+    // keep headers and buffers pointer aligned
+    size_t need = sizeof(MemBlock) + ((Size + sizeof(void *) - 1) & ~(sizeof(void *) - 1));
+
+    if (need <= size_t(m_Limit - m_Cursor))
+    {
+        // common case: carve from the current chunk
+        pRaw = m_Cursor;
+        m_Cursor += need;
+    }
+    else if ((need + sizeof(MemBlock *)) > m_ChunkSize)
+    {
+        // oversized requests get a chunk of their own so the current one is not abandoned
+        MemBlock *pChunk = ChunkAdd(need + sizeof(MemBlock *));
+
+        if (pChunk == NULL)
+        {
+            return false;
+        }
+
+        pRaw = pChunk->BuffGet() + sizeof(MemBlock *);
+    }
+    else
+    {
+        // start carving a fresh chunk
+        m_Current = ChunkAdd(m_ChunkSize);
+
+        if (m_Current == NULL)
+        {
+            m_Cursor = m_Limit = NULL;
+            return false;
+        }
+
+        pRaw = m_Current->BuffGet() + sizeof(MemBlock *);
+        m_Cursor = pRaw + need;
+        m_Limit = m_Current->BuffGet() + m_Current->SizeGet();
+    }
+
+    Mem = new (pRaw) MemBlock(Size);
+    Mem->GuardRegion();
+
+    m_Used += need;
+    ++m_Count;
+
+    return true;
+}
+
+
+// get a buffer of memory from the region
+void *MemRegion::Allocate(size_t Size)
+{
+    MemBlock *pBlk;
+
+    return MemBlockGet(pBlk, Size) ? pBlk->BuffGet() : NULL;
+}
+
+
+// recover all blocks, keeping one chunk
+void MemRegion::Reset()
+{
+    MemBlock *pChunk = m_Chunks;
+    MemRegion::Suspend suspend;
+
+    // return every chunk except the one being carved
+    while (pChunk != NULL)
+    {
+        MemBlock *pNext = pChunk->NextGet();
+
+        if (pChunk != m_Current)
+        {
+            m_Mgr->MemBlockPut(pChunk);
+            --m_ChunkCount;
+        }
+
+        pChunk = pNext;
+    }
+
+    m_Chunks = m_Current;
+    m_Used = 0;
+    m_Count = 0;
+
+    if (m_Current != NULL)
+    {
+        m_Current->NextSet(NULL);
+        m_Cursor = m_Current->BuffGet() + sizeof(MemBlock *);
+    }
+}
+
+
+// recover all blocks and return all chunks
+void MemRegion::Release()
+{
+    MemBlock *pChunk = m_Chunks;
+    MemRegion::Suspend suspend;
+
+    while (pChunk != NULL)
+    {
+        MemBlock *pNext = pChunk->NextGet();
+        m_Mgr->MemBlockPut(pChunk);
+        pChunk = pNext;
+    }
+
+    m_Chunks = NULL;
+    m_Current = NULL;
+    m_Cursor = NULL;
+    m_Limit = NULL;
+    m_ChunkCount = 0;
+    m_Used = 0;
+    m_Count = 0;
+}
+
+
+// borrow a chunk that holds at least Size bytes
+MemBlock *MemRegion::ChunkAdd(size_t Size)
+{
+    MemBlock *pChunk = NULL;
+
+    // chunks must come from the manager, not from a bound region
+    MemRegion::Suspend suspend;
+
+    if (m_Mgr->MemBlockGet(pChunk, Size) == false)
+    {
+        LogErr << "MemRegion::ChunkAdd(): Failed to acquire chunk of size: "
+               << Size << std::endl;
+        return NULL;
+    }
+
+    // link the chunk through the first word of its buffer
+    pChunk->NextSet(m_Chunks);
+    m_Chunks = pChunk;
+    ++m_ChunkCount;
+
+    return pChunk;
+}
+
+}   // namespace cp
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpMemRegion.h
+//
+//  Description:    Monotonic Memory Region.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_MEMREGION_H
+#define CP_MEMREGION_H
+
+#include "cpMemMgr.h"
+
+// ----------------------------------------------------------------------------
+// A region hands out memory blocks by advancing a pointer through large chunks
+// that it borrows from a MemManager.  Returning a region block does nothing;
+// the memory is recovered all at once when the region is reset or destroyed.
+// This suits groups of short-lived objects that die together, such as the
+// scratch built while decoding a single message.
+//
+// Region blocks carry a normal block header marked with a distinct sentinel,
+// so any MemBlockPut() path (PooledBase delete, Alloc<T>::deallocate(), Buffer)
+// recognizes and ignores them.  Blocks are drawn from a region explicitly with
+// Alloc<T>(&Region) or new (Region) on PooledBase objects, or implicitly by
+// binding the region to the calling thread with a MemRegion::Scope.  While a
+// region is bound, requests to the process-wide MemManager instance are served
+// from the region.  Code that creates state which outlives the bound scope
+// (singletons, pooled objects) must hold a MemRegion::Suspend while doing so.
+//
+// A region is not thread safe and must only be used by one thread at a time.
+// ----------------------------------------------------------------------------
+
+namespace cp
+{
+
+class MemRegion
+{
+public:
+    // binds a region to the calling thread for the lifetime of the scope
+    class Scope
+    {
+    public:
+        explicit Scope(MemRegion &Region);
+        ~Scope();
+
+    private:
+        MemRegion      *m_Prev;                             // region bound before this scope
+    };
+
+    // unbinds any region from the calling thread for the lifetime of the scope
+    class Suspend
+    {
+    public:
+        Suspend();
+        ~Suspend();
+
+    private:
+        MemRegion      *m_Prev;                             // region bound before this scope
+    };
+
+    // constructor
+    explicit MemRegion(size_t ChunkSize = k_DefaultIoBufSize, MemManager *Mgr = NULL);
+
+    // destructor
+    ~MemRegion();
+
+    // accessors
+    size_t ChunkSizeGet() const { return m_ChunkSize; }     // return the standard chunk size
+    size_t ChunkCountGet() const { return m_ChunkCount; }   // return the number of chunks held
+    size_t UsedGet() const { return m_Used; }               // return bytes handed out since the last reset
+    uint32_t CountGet() const { return m_Count; }           // return blocks handed out since the last reset
+
+    // manipulators
+    bool MemBlockGet(MemBlock * &Mem, size_t Size);         // get a block of memory from the region
+    void *Allocate(size_t Size);                            // get a buffer of memory from the region
+    void Reset();                                           // recover all blocks, keeping one chunk
+    void Release();                                         // recover all blocks and return all chunks
+
+    // static accessors
+    static MemRegion *BoundGet() { return m_PtrBound; }     // return the region bound to the calling thread
+
+private:
+    // copy constructor
+    MemRegion(MemRegion &rhs);
+
+    // operators
+    MemRegion &operator=(MemRegion &rhs);
+
+    MemBlock *ChunkAdd(size_t Size);                        // borrow a chunk that holds at least Size bytes
+
+    MemManager         *m_Mgr;                              // memory manager that supplies the chunks
+    size_t              m_ChunkSize;                        // standard chunk size
+    size_t              m_ChunkCount;                       // number of chunks held
+    size_t              m_Used;                             // bytes handed out since the last reset
+    uint32_t            m_Count;                            // blocks handed out since the last reset
+    MemBlock           *m_Chunks;                           // list of chunks held, most recent first
+    MemBlock           *m_Current;                          // chunk currently being carved
+    char               *m_Cursor;                           // next free byte in the current chunk
+    char               *m_Limit;                            // end of the current chunk
+    static thread_local MemRegion *m_PtrBound;              // region bound to the calling thread
+};
+
+}   // namespace cp
+
+#endif  // CP_MEMREGION_H
@@ -0,0 +1,310 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpNumIo.cpp
+//
+//  Description:    Numeric Text Conversion Function Library.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include "cpUtil.h"
+
+// the library provides shortest round trip floating point formatting
+#if defined(__cpp_lib_to_chars)
+#define CP_TO_CHARS
+#endif
+
+namespace cp
+{
+
+// two digit decimal text for each value from 0 to 99
+static char const k_DigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// most digits that cannot overflow an unsigned long long
+static size_t const k_SafeDigits = 19;
+
+// assemble a little endian long long word regardless of the host
+static inline uint64_t Read64(char const *p)
+{
+    uint8_t const *u = reinterpret_cast<uint8_t const *>(p);
+
+    return uint64_t(u[0]) | (uint64_t(u[1]) << 8) | (uint64_t(u[2]) << 16) | (uint64_t(u[3]) << 24) |
+           (uint64_t(u[4]) << 32) | (uint64_t(u[5]) << 40) | (uint64_t(u[6]) << 48) | (uint64_t(u[7]) << 56);
+}
+
+
+// determine if eight characters, first in the low octet, are all decimal digits
+static inline bool EightDigits(uint64_t Chars)
+{
+    // each octet must be 0x30-0x39, so adding 6 must not carry out of the low nibble
+    return ((Chars & 0xf0f0f0f0f0f0f0f0ULL) == 0x3030303030303030ULL) &&
+           (((Chars + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) == 0x3030303030303030ULL);
+}
+
+
+// convert eight decimal digits, first in the low octet, to their value
+static inline uint32_t EightDigitsVal(uint64_t Chars)
+{
+    // combine neighbouring digits, then pairs, then quads in parallel lanes
+    Chars -= 0x3030303030303030ULL;
+    Chars = (Chars * 10) + (Chars >> 8);
+    Chars = (((Chars & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) +
+             (((Chars >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >> 32;
+
+    return static_cast<uint32_t>(Chars);
+}
+
+
+// parse the digits of a number, returning the number of characters used
+static size_t DigitsParse(char const *pStr, size_t Len, uint64_t &Val, bool &Overflow)
+{
+    size_t pos = 0;
+    size_t sig = 0;
+    uint64_t val = 0;
+
+    Overflow = false;
+
+    // leading zeros add nothing
+    while ((pos < Len) && (pStr[pos] == '0'))
+    {
+        ++pos;
+    }
+
+    // eight digits at a time while the value cannot overflow
+    while (((pos + 8) <= Len) && ((sig + 8) <= k_SafeDigits) && EightDigits(Read64(pStr + pos)))
+    {
+        val = (val * 100000000) + EightDigitsVal(Read64(pStr + pos));
+        pos += 8;
+        sig += 8;
+    }
+
+    // then one at a time, checking for overflow
+    while ((pos < Len) && (pStr[pos] >= '0') && (pStr[pos] <= '9'))
+    {
+        uint64_t digit = pStr[pos] - '0';
+
+        if (val > ((UINT64_MAX - digit) / 10))
+        {
+            Overflow = true;
+        }
+        else
+        {
+            val = (val * 10) + digit;
+        }
+
+        ++pos;
+    }
+
+    Val = val;
+
+    return pos;
+}
+
+
+// parse the white space and sign that may precede a number
+static size_t SignParse(char const *pStr, size_t Len, bool &Negative)
+{
+    size_t pos = 0;
+
+    while ((pos < Len) && ((pStr[pos] == ' ') || ((pStr[pos] >= '\t') && (pStr[pos] <= '\r'))))
+    {
+        ++pos;
+    }
+
+    Negative = (pos < Len) && (pStr[pos] == '-');
+
+    if ((pos < Len) && ((pStr[pos] == '-') || (pStr[pos] == '+')))
+    {
+        ++pos;
+    }
+
+    return pos;
+}
+
+
+#if !defined(CP_TO_CHARS)
+// format with the fewest significant digits that read back as the same value
+template <typename T>
+static size_t FloatFormat(char *pBuf, T Val, int MaxDigits)
+{
+    int len = 0;
+
+    for (int digits = 1; digits <= MaxDigits; ++digits)
+    {
+        len = snprintf(pBuf, k_NumTextLen, "%.*g", digits, static_cast<double>(Val));
+
+        if (static_cast<T>(strtod(pBuf, NULL)) == Val)
+        {
+            break;
+        }
+    }
+
+    return (len > 0) ? static_cast<size_t>(len) : 0;
+}
+#endif
+
+// ----------------------------------------------------------------------------
+
+// converts integer to decimal text
+size_t IntToChars(char *pBuf, int64_t Val)
+{
+    if (Val < 0)
+    {
+        // negate as unsigned so the most negative value works
+        *pBuf = '-';
+        return UintToChars(pBuf + 1, 0 - static_cast<uint64_t>(Val)) + 1;
+    }
+
+    return UintToChars(pBuf, static_cast<uint64_t>(Val));
+}
+
+
+// converts unsigned integer to decimal text
+size_t UintToChars(char *pBuf, uint64_t Val)
+{
+    char text[k_NumTextLen];
+    char *pText = text + sizeof(text);
+    size_t len = 0;
+
+    // produce two digits per division from the least significant end
+    while (Val >= 100)
+    {
+        pText -= 2;
+        memcpy(pText, k_DigitPairs + ((Val % 100) * 2), 2);
+        Val /= 100;
+    }
+
+    if (Val >= 10)
+    {
+        pText -= 2;
+        memcpy(pText, k_DigitPairs + (Val * 2), 2);
+    }
+    else
+    {
+        *--pText = static_cast<char>('0' + Val);
+    }
+
+    len = (text + sizeof(text)) - pText;
+    memcpy(pBuf, pText, len);
+    pBuf[len] = '\0';
+
+    return len;
+}
+
+
+// converts double float to the shortest text that reads back as the same value
+size_t FloatToChars(char *pBuf, double Val)
+{
+#if defined(CP_TO_CHARS)
+    std::to_chars_result res = std::to_chars(pBuf, pBuf + k_NumTextLen - 1, Val);
+    *res.ptr = '\0';
+
+    return res.ptr - pBuf;
+#else
+    return FloatFormat(pBuf, Val, 17);
+#endif
+}
+
+
+// converts single float to the shortest text that reads back as the same value
+size_t FloatToChars(char *pBuf, float Val)
+{
+#if defined(CP_TO_CHARS)
+    std::to_chars_result res = std::to_chars(pBuf, pBuf + k_NumTextLen - 1, Val);
+    *res.ptr = '\0';
+
+    return res.ptr - pBuf;
+#else
+    return FloatFormat(pBuf, Val, 9);
+#endif
+}
+
+
+// converts decimal text to integer
+size_t CharsToInt(char const *pStr, size_t Len, int64_t &Val)
+{
+    bool negative = false;
+    bool overflow = false;
+    uint64_t mag = 0;
+    size_t pos = SignParse(pStr, Len, negative);
+    size_t num = DigitsParse(pStr + pos, Len - pos, mag, overflow);
+
+    Val = 0;
+
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    // out of range values saturate
+    if (negative)
+    {
+        Val = (overflow || (mag > (uint64_t(INT64_MAX) + 1))) ? INT64_MIN : static_cast<int64_t>(0 - mag);
+    }
+    else
+    {
+        Val = (overflow || (mag > uint64_t(INT64_MAX))) ? INT64_MAX : static_cast<int64_t>(mag);
+    }
+
+    return pos + num;
+}
+
+
+// converts decimal text to unsigned integer
+size_t CharsToUint(char const *pStr, size_t Len, uint64_t &Val)
+{
+    bool negative = false;
+    bool overflow = false;
+    uint64_t mag = 0;
+    size_t pos = SignParse(pStr, Len, negative);
+    size_t num = DigitsParse(pStr + pos, Len - pos, mag, overflow);
+
+    Val = 0;
+
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    // out of range values saturate and a minus sign negates, as with strtoull()
+    if (overflow)
+    {
+        Val = UINT64_MAX;
+    }
+    else
+    {
+        Val = negative ? (0 - mag) : mag;
+    }
+
+    return pos + num;
+}
+
+}   // namespace cp
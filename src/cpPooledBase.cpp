@@ -19,12 +19,14 @@
 //  2012-02-29  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2022-02-28  asc Updated exception handling for C++11 and newer.
+//  2026-10-16  asc Added new operators that allocate from a given arena.
+//  2026-10-16  asc Added new operators that allocate from a MemRegion.
 // ----------------------------------------------------------------------------
 
 #include <new>
 
 #include "cpPooledBase.h"
-#include "cpMemMgr.h"
+#include "cpMemRegion.h"
 
 namespace cp
 {
@@ -67,6 +69,42 @@ void *PooledBase::operator new(size_t Size, void *Ptr) throw()
 }
 
 
+// arena new operator (throws exceptions)
+// instances are released with a plain delete, which returns the block
+// to the arena that owns it
+void *PooledBase::operator new(size_t Size, MemManager &Arena) noexcept(false)
+{
+    MemBlock *pMem = NULL;
+
+    if (Arena.MemBlockGet(pMem, Size) == false)
+    {
+        LogErr << "PooledBase::operator new(): Failed to acquire arena memory block of size: "
+               << Size << std::endl;
+        throw std::bad_alloc();
+    }
+
+    return pMem->BuffGet();
+}
+
+
+// region new operator (throws exceptions)
+// instances may be released with a plain delete, which runs the destructor
+// and leaves the memory to be recovered with the region
+void *PooledBase::operator new(size_t Size, MemRegion &Region) noexcept(false)
+{
+    void *pMem = Region.Allocate(Size);
+
+    if (pMem == NULL)
+    {
+        LogErr << "PooledBase::operator new(): Failed to acquire region memory of size: "
+               << Size << std::endl;
+        throw std::bad_alloc();
+    }
+
+    return pMem;
+}
+
+
 // overridden array new operator (throws exceptions)
 void *PooledBase::operator new[](size_t Size) noexcept(false)
 {
@@ -105,6 +143,38 @@ void *PooledBase::operator new[](size_t Size, void *Ptr) throw()
 }
 
 
+// arena array new operator (throws exceptions)
+void *PooledBase::operator new[](size_t Size, MemManager &Arena) noexcept(false)
+{
+    MemBlock *pMem = NULL;
+
+    if (Arena.MemBlockGet(pMem, Size) == false)
+    {
+        LogErr << "PooledBase::operator new[](): Failed to acquire arena memory block of size: "
+               << Size << std::endl;
+        throw std::bad_alloc();
+    }
+
+    return pMem->BuffGet();
+}
+
+
+// region array new operator (throws exceptions)
+void *PooledBase::operator new[](size_t Size, MemRegion &Region) noexcept(false)
+{
+    void *pMem = Region.Allocate(Size);
+
+    if (pMem == NULL)
+    {
+        LogErr << "PooledBase::operator new[](): Failed to acquire region memory of size: "
+               << Size << std::endl;
+        throw std::bad_alloc();
+    }
+
+    return pMem;
+}
+
+
 // overridden delete operator (throws exceptions)
 void  PooledBase::operator delete(void *Ptr) throw()
 {
@@ -134,6 +204,17 @@ void  PooledBase::operator delete(void *Ptr, void *pSys) throw()
 }
 
 
+// arena delete operator (called if a constructor throws during arena new)
+void  PooledBase::operator delete(void *Ptr, MemManager &Arena) throw()
+{
+    if (Arena.MemBlockPut(reinterpret_cast<char * &>(Ptr)) == false)
+    {
+        LogErr << "PooledBase::operator delete(): Failed to return arena memory block: "
+               << Ptr << std::endl;
+    }
+}
+
+
 // overridden array delete operator (throws exceptions)
 void  PooledBase::operator delete[](void *Ptr) throw()
 {
@@ -162,4 +243,33 @@ void  PooledBase::operator delete[](void *Ptr, void *pSys) throw()
     ::operator delete[](Ptr, pSys);
 }
 
+
+// arena array delete operator (called if a constructor throws during arena new)
+void  PooledBase::operator delete[](void *Ptr, MemManager &Arena) throw()
+{
+    if (Arena.MemBlockPut(reinterpret_cast<char * &>(Ptr)) == false)
+    {
+        LogErr << "PooledBase::operator delete[](): Failed to return arena memory block: "
+               << Ptr << std::endl;
+    }
+}
+
+
+// region delete operator (called if a constructor throws during region new)
+void  PooledBase::operator delete(void *Ptr, MemRegion &Region) throw()
+{
+    // memory is recovered with the region
+    (void)Ptr;
+    (void)Region;
+}
+
+
+// region array delete operator (called if a constructor throws during region new)
+void  PooledBase::operator delete[](void *Ptr, MemRegion &Region) throw()
+{
+    // memory is recovered with the region
+    (void)Ptr;
+    (void)Region;
+}
+
 }   // namespace cp
@@ -19,6 +19,8 @@
 //  2012-02-29  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2022-02-28  asc Updated exception handling for C++11 and newer.
+//  2026-10-16  asc Added new operators that allocate from a given arena.
+//  2026-10-16  asc Added new operators that allocate from a MemRegion.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_POOLEDBASE_H
@@ -29,6 +31,9 @@
 namespace cp
 {
 
+class MemManager;
+class MemRegion;
+
 class PooledBase
 {
 public:
@@ -47,18 +52,26 @@ public:
     static void *operator new(size_t Size) noexcept(false);
     static void *operator new(size_t Size, const std::nothrow_t &) throw();
     static void *operator new(size_t Size, void *Ptr) throw();
+    static void *operator new(size_t Size, MemManager &Arena) noexcept(false);
+    static void *operator new(size_t Size, MemRegion &Region) noexcept(false);
 
     static void *operator new[](size_t Size) noexcept(false);
     static void *operator new[](size_t Size, const std::nothrow_t &) throw();
     static void *operator new[](size_t Size, void *Ptr) throw();
+    static void *operator new[](size_t Size, MemManager &Arena) noexcept(false);
+    static void *operator new[](size_t Size, MemRegion &Region) noexcept(false);
 
     static void  operator delete(void *Ptr) throw();
     static void  operator delete(void *Ptr, const std::nothrow_t &) throw();
     static void  operator delete(void *Ptr, void *pSys) throw();
+    static void  operator delete(void *Ptr, MemManager &Arena) throw();
+    static void  operator delete(void *Ptr, MemRegion &Region) throw();
 
     static void  operator delete[](void *Ptr) throw();
     static void  operator delete[](void *Ptr, const std::nothrow_t &) throw();
     static void  operator delete[](void *Ptr, void *pSys) throw();
+    static void  operator delete[](void *Ptr, MemManager &Arena) throw();
+    static void  operator delete[](void *Ptr, MemRegion &Region) throw();
 
 protected:
 
@@ -14,6 +14,7 @@
 //  History:
 //  2011-05-16  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
+//  2026-10-16  asc Released the decode stack when a decode completes.
 // ----------------------------------------------------------------------------
 
 #include "cpSerDes.h"
@@ -107,6 +108,9 @@ bool SerDes::Decode(StreamBase &Stream, Datum &Dat, bool Check)
         Dat.Clear();
     }
 
+    // release the stack so a pooled serializer holds no memory from this decode
+    Clear();
+
     return rv;
 }
 
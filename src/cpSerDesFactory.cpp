@@ -15,11 +15,13 @@
 //  2011-06-23  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2013-11-15  asc Added IDL ser/des.
+//  2026-10-16  asc Kept pooled serializers out of thread bound memory regions.
 // ----------------------------------------------------------------------------
 
 #include "cpSerDesNative.h"
 #include "cpSerDesXml.h"
 #include "cpSerDesIdl.h"
+#include "cpMemRegion.h"
 
 namespace cp
 {
@@ -58,6 +60,8 @@ SerDesFactory *SerDesFactory::InstanceGet()
 {
     if (m_PtrInstance == NULL)
     {
+        // the factory outlives any region bound to the calling thread
+        MemRegion::Suspend suspend;
         m_PtrInstance = new (CP_NEW) SerDesFactory;
     }
 
@@ -104,6 +108,9 @@ SerDes *SerDesFactory::SerDesGet(String const &Enc)
     SerDes *rv = NULL;
     SerDesPoolMap_t::iterator i;
 
+    // serializers are pooled, so they must not come from a bound region
+    MemRegion::Suspend suspend;
+
     m_Mutex.Lock();
 
     // search for the encoder type in the pool map
@@ -148,6 +155,9 @@ bool SerDesFactory::SerDesPut(SerDes * &pSerDes)
 
     if (pSerDes != NULL)
     {
+        // the pool outlives any region bound to the calling thread
+        MemRegion::Suspend suspend;
+
         m_Mutex.Lock();
         m_Pools[pSerDes->NameGet()].push_back(pSerDes);
         m_Mutex.Unlock();
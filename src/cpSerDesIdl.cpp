@@ -14,6 +14,9 @@
 //  History:
 //  2013-11-15  asc Creation.
 //  2013-11-15  asc Fixed handling of checksum calculations.
+//  2026-10-16  asc Moved decoded attributes into the datum.
+//  2026-10-16  asc Moved decoded blobs into the variant.
+//  2026-10-16  asc Formatted numbers into local buffers instead of string streams.
 // ----------------------------------------------------------------------------
 
 #include <sstream>
@@ -302,73 +305,89 @@ bool SerDesIdl::NewLineInsert()
 // encode an unsigned long into the output buffer
 bool SerDesIdl::UnsignedLongInsert(uint32_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, UintToChars(buf, Val));
 }
 
 
 // encode a signed long into the output buffer
 bool SerDesIdl::SignedLongInsert(int32_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, IntToChars(buf, Val));
 }
 
 
 // encode an unsigned long long into the output buffer
 bool SerDesIdl::UnsignedLongLongInsert(uint64_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, UintToChars(buf, Val));
 }
 
 
 // encode a signed long long into the output buffer
 bool SerDesIdl::SignedLongLongInsert(int64_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, IntToChars(buf, Val));
 }
 
 
 // encode a single float into the output buffer
 bool SerDesIdl::Float32Insert(float Val)
 {
-    std::stringstream ss;
-    ss.precision(k_FloatDigits);
-    ss << std::fixed << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    // the shortest text that reads back as the same value
+    return CharsInsert(buf, FloatToChars(buf, Val));
 }
 
 
 // encode a double float into the output buffer
 bool SerDesIdl::Float64Insert(double Val)
 {
-    std::stringstream ss;
-    ss.precision(k_DoubleDigits);
-    ss << std::fixed << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    // the shortest text that reads back as the same value
+    return CharsInsert(buf, FloatToChars(buf, Val));
 }
 
 
 // encode a string into the output buffer
 bool SerDesIdl::StringInsert(String const &Str)
 {
+    return CharsInsert(Str.c_str(), Str.size());
+}
+
+
+// encode a run of characters into the output buffer
+bool SerDesIdl::CharsInsert(char const *pStr, size_t Len)
+{
+    static char const blanks[] = "                                ";
     bool rv = (m_PtrStream != NULL);
-    size_t size = Str.size();
 
     if (m_NewLine)
     {
         size_t indent = m_IndentSize * m_IndentLevel;
-        rv = rv && (m_PtrStream->ArrayWr(GenStr(indent, ' ').c_str(), indent) == indent);
+
+        // indent from a run of blanks instead of building a string
+        while (rv && (indent > 0))
+        {
+            size_t size = (indent < (sizeof(blanks) - 1)) ? indent : (sizeof(blanks) - 1);
+
+            rv = (m_PtrStream->ArrayWr(blanks, size) == size);
+            indent -= size;
+        }
+
         m_NewLine = false;
     }
 
-    rv = rv && (m_PtrStream->ArrayWr(Str.c_str(), size) == size);
+    rv = rv && (m_PtrStream->ArrayWr(pStr, Len) == Len);
 
     return rv;
 }
@@ -476,11 +495,11 @@ bool SerDesIdl::VariantExtract(Variant &Var, Variant::DataType_t Type, String co
         break;
 
     case Variant::dt_int64:
-        Var.Int64Set(StrToInt(Value));
+        Var.Int64Set(StrToInt64(Value));
         break;
 
     case Variant::dt_uint64:
-        Var.Uint64Set(StrToUint(Value));
+        Var.Uint64Set(StrToUint64(Value));
         break;
 
     case Variant::dt_float32:
@@ -503,7 +522,7 @@ bool SerDesIdl::VariantExtract(Variant &Var, Variant::DataType_t Type, String co
         {
             Buffer buf;
             HexDecode(Value, buf);
-            Var.BufSet(buf);
+            Var.BufSet(std::move(buf));
         }
         break;
 
@@ -666,7 +685,7 @@ bool SerDesIdl::DecodeElement()
                         }
 
                         rv = VariantExtract(var, attributeType, value);
-                        pDat->AttrSet(i->second, var);
+                        pDat->AttrSet(i->second, std::move(var));
                     }
 
                     ++i;
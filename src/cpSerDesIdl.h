@@ -13,6 +13,7 @@
 //
 //  History:
 //  2013-11-15  asc Creation.
+//  2026-10-16  asc Added CharsInsert().
 // ----------------------------------------------------------------------------
 
 #ifndef CP_SERDESIDL_H
@@ -70,6 +71,7 @@ private:
     bool Float32Insert(float Val);                          // encode a single float into the output buffer
     bool Float64Insert(double Val);                         // encode a double float into the output buffer
     bool StringInsert(String const &Str);                   // encode a string into the output buffer
+    bool CharsInsert(char const *pStr, size_t Len);         // encode a run of characters into the output buffer
     bool BlobInsert(Buffer const &Buf);                     // encode a BLOB into the output buffer
 
     bool OpenTagInsert(String const &TagName, bool Attribute = false);
@@ -18,8 +18,14 @@
 //  2013-02-08  asc Improved extraction handling of zero length strings and blobs.
 //  2013-06-07  asc Corrected extraction handling of dt_none elements.
 //  2013-11-15  asc Fixed handling of checksum calculations.
+//  2026-10-16  asc Moved decoded attributes into the datum.
+//  2026-10-16  asc Moved decoded blobs into the variant.
+//  2026-10-16  asc Skipped zero fill of string and blob extraction buffers.
+//  2026-10-16  asc Encoded and decoded numeric fields in place in the stream.
+//  2026-10-16  asc Dispatched checksums through the checksum registry.
 // ----------------------------------------------------------------------------
 
+#include "cpChecksum.h"
 #include "cpStreamBase.h"
 #include "cpUtil.h"
 
@@ -105,6 +111,8 @@ bool SerDesNative::Close(Datum::CheckSum_t ChkMode)
 {
     bool rv = (m_PtrStream != NULL);
     size_t pos = 0;
+    uint64_t sum = 0;
+    ChecksumRegistry::Algorithm alg;
 
     // insert the terminator
     rv = rv && OctetInsert(mk_PkgEnd);
@@ -117,21 +125,21 @@ bool SerDesNative::Close(Datum::CheckSum_t ChkMode)
         rv = rv && OctetInsert(mk_Chk);
         rv = rv && OctetInsert(ChkMode);
 
-        // generate and insert optional checksum
-        switch (ChkMode)
+        // generate and insert the checksum, most significant octet first
+        if (ChecksumRegistry::InstanceGet()->Find(ChkMode, alg))
         {
-        case Datum::ck_Crc32:
-            rv = rv && LongInsert(m_PtrStream->Crc32Get(pos));
-            break;
-
-        case Datum::ck_Md5Sum:
-            break;
+            sum = alg.m_PtrFunc(*m_PtrStream, pos);
 
-        case Datum::ck_Sha1Sum:
-            break;
-
-        default:
-            break;
+            for (size_t i = alg.m_Size; i > 0; --i)
+            {
+                rv = rv && OctetInsert(uint8_t(sum >> ((i - 1) * 8)));
+            }
+        }
+        else
+        {
+            LogErr << "SerDesNative::Close(): Unsupported checksum mode: "
+                   << uint32_t(ChkMode) << std::endl;
+            rv = false;
         }
 
         // add the closing marker
@@ -285,24 +293,9 @@ bool SerDesNative::OctetInsert(uint8_t Val)
 // encode a short into the output stream
 bool SerDesNative::ShortInsert(uint16_t Val)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
+    bool rv = (m_PtrStream != NULL);
 
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
-    }
+    rv = rv && m_PtrStream->Uint16InsertB(Val);
 
     return rv;
 }
@@ -311,24 +304,9 @@ bool SerDesNative::ShortInsert(uint16_t Val)
 // encode a long into the output stream
 bool SerDesNative::LongInsert(uint32_t Val)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
+    bool rv = (m_PtrStream != NULL);
 
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
-    }
+    rv = rv && m_PtrStream->Uint32InsertB(Val);
 
     return rv;
 }
@@ -337,24 +315,9 @@ bool SerDesNative::LongInsert(uint32_t Val)
 // encode a long long into the output stream
 bool SerDesNative::LongLongInsert(uint64_t Val)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
+    bool rv = (m_PtrStream != NULL);
 
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
-    }
+    rv = rv && m_PtrStream->Uint64InsertB(Val);
 
     return rv;
 }
@@ -363,24 +326,9 @@ bool SerDesNative::LongLongInsert(uint64_t Val)
 // encode a single float into the output stream
 bool SerDesNative::Float32Insert(float Val)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
+    bool rv = (m_PtrStream != NULL);
 
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
-    }
+    rv = rv && m_PtrStream->Float32InsertB(Val);
 
     return rv;
 }
@@ -389,24 +337,9 @@ bool SerDesNative::Float32Insert(float Val)
 // encode a double float into the output stream
 bool SerDesNative::Float64Insert(double Val)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
+    bool rv = (m_PtrStream != NULL);
 
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
-    }
+    rv = rv && m_PtrStream->Float64InsertB(Val);
 
     return rv;
 }
@@ -506,128 +439,75 @@ bool SerDesNative::OctetExtract(uint8_t &Val)
 // decode a short from the input stream
 bool SerDesNative::ShortExtract(uint16_t &Val)
 {
-    bool rv = true;
-    uint8_t *pDst = reinterpret_cast<uint8_t *>(&Val);
-    size_t i;
-
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetExtract(pDst[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetExtract(pDst[i]);
-        }
-    }
-
-    return rv;
+    return FieldExtract(&Val, sizeof(Val));
 }
 
 
 // decode a long from the input stream
 bool SerDesNative::LongExtract(uint32_t &Val)
 {
-    bool rv = true;
-    uint8_t *pDst = reinterpret_cast<uint8_t *>(&Val);
-    size_t i;
-
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetExtract(pDst[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetExtract(pDst[i]);
-        }
-    }
-
-    return rv;
+    return FieldExtract(&Val, sizeof(Val));
 }
 
 
 // decode a long long from the input stream
 bool SerDesNative::LongLongExtract(uint64_t &Val)
 {
-    bool rv = true;
-    uint8_t *pDst = reinterpret_cast<uint8_t *>(&Val);
-    size_t i;
-
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetExtract(pDst[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetExtract(pDst[i]);
-        }
-    }
-
-    return rv;
+    return FieldExtract(&Val, sizeof(Val));
 }
 
 
 // decode a single float from the input stream
 bool SerDesNative::Float32Extract(float &Val)
 {
-    bool rv = true;
-    uint8_t *pDst = reinterpret_cast<uint8_t *>(&Val);
-    size_t i;
-
-    if (cp::HostLittleEndian())
-    {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetExtract(pDst[i-1]);
-        }
-    }
-    else
-    {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetExtract(pDst[i]);
-        }
-    }
-
-    return rv;
+    return FieldExtract(&Val, sizeof(Val));
 }
 
 
 // decode a double float from the input stream
 bool SerDesNative::Float64Extract(double &Val)
 {
-    bool rv = true;
-    uint8_t *pDst = reinterpret_cast<uint8_t *>(&Val);
-    size_t i;
+    return FieldExtract(&Val, sizeof(Val));
+}
 
-    if (cp::HostLittleEndian())
+
+// decode a fixed-size network order field from the input stream
+bool SerDesNative::FieldExtract(void *pVal, size_t Size)
+{
+    bool rv = (m_PtrStream != NULL);
+    uint8_t field[sizeof(uint64_t)];
+    uint8_t *pDst = static_cast<uint8_t *>(pVal);
+    char const *pSrc = NULL;
+    size_t i = 0;
+
+    // load directly from the current block when the field is contiguous
+    if (rv)
     {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetExtract(pDst[i-1]);
-        }
+        pSrc = m_PtrStream->Peek(Size);
+    }
+
+    if (pSrc != NULL)
+    {
+        memcpy(field, pSrc, Size);
+        rv = m_PtrStream->Consume(Size);
     }
     else
     {
-        for (i = 0; i < sizeof(Val); ++i)
+        rv = rv && (m_PtrStream->ArrayRd(field, Size) == Size);
+    }
+
+    // convert to host byte order
+    if (rv && cp::HostLittleEndian())
+    {
+        for (i = 0; i < Size; ++i)
         {
-            rv = rv && OctetExtract(pDst[i]);
+            pDst[i] = field[Size - i - 1];
         }
     }
+    else if (rv)
+    {
+        memcpy(pDst, field, Size);
+    }
 
     return rv;
 }
@@ -646,7 +526,7 @@ bool SerDesNative::StringExtract(String &Str)
     if (len > 0)
     {
         // resize buffer to accomodate length of string + terminator
-        rv = rv && buf.Resize(len + sizeof(char));
+        rv = rv && buf.Resize(len + sizeof(char), false);
 
         // read the block
         rv = rv && (m_PtrStream->Read(buf, len) == len);
@@ -679,7 +559,7 @@ bool SerDesNative::BlobExtract(Buffer &Buf)
     if (len > 0)
     {
         // resize buffer to accomodate length of block
-        rv = rv && Buf.Resize(len);
+        rv = rv && Buf.Resize(len, false);
 
         // read the block
         rv = rv && (m_PtrStream->Read(Buf, len) == len);
@@ -800,7 +680,7 @@ bool SerDesNative::VariantExtract(Variant &Var, Variant::DataType_t Type)
         {
             Buffer buf;
             rv = BlobExtract(buf);
-            Var.BufSet(buf);
+            Var.BufSet(std::move(buf));
         }
         break;
 
@@ -936,7 +816,7 @@ bool SerDesNative::DecodeElement()
 
                     if (rv)
                     {
-                        pDat->AttrSet(attrib, var);
+                        pDat->AttrSet(attrib, std::move(var));
                     }
                 }
                 break;
@@ -955,10 +835,11 @@ bool SerDesNative::DecodeElement()
 bool SerDesNative::DecodeChecksum()
 {
     bool rv = (m_PtrStream != NULL);
-    uint32_t crcs = 0;
-    uint32_t crcr = 0;
+    uint64_t sums = 0;
+    uint64_t sumr = 0;
     uint8_t ch;
-    size_t pos = m_PtrStream->Pos();
+    size_t pos = rv ? m_PtrStream->Pos() : 0;
+    ChecksumRegistry::Algorithm alg;
 
     // get what should be the checksum package start marker
     rv = rv && OctetExtract(ch) && (ch == mk_Chk);
@@ -966,36 +847,27 @@ bool SerDesNative::DecodeChecksum()
     // get the checksum type marker
     rv = rv && OctetExtract(ch);
 
-    if (rv)
-    {
-        switch (ch)
-        {
-        case Datum::ck_Crc32:
-            // get the crc from the message
-            rv = rv && LongExtract(crcs);
-
-            if (rv)
-            {
-                // calculate crc of local copy
-                crcr = m_PtrStream->Crc32Get(pos);
-
-                // result good if they match
-                rv = (crcs == crcr);
-            }
-            break;
+    // a checksum that cannot be calculated cannot be verified
+    rv = rv && ChecksumRegistry::InstanceGet()->Find(ch, alg);
 
-        case Datum::ck_Md5Sum:
-            rv = false;
-            break;
+    // get the checksum from the message, most significant octet first
+    for (size_t i = 0; rv && (i < alg.m_Size); ++i)
+    {
+        rv = OctetExtract(ch);
+        sums = (sums << 8) | ch;
+    }
 
-        case Datum::ck_Sha1Sum:
-            rv = false;
-            break;
+    if (rv)
+    {
+        // calculate the checksum of the local copy, result good if they match
+        sumr = alg.m_PtrFunc(*m_PtrStream, pos);
 
-        default:
-            rv = true;
-            break;
+        if (alg.m_Size < sizeof(sumr))
+        {
+            sumr &= (uint64_t(1) << (alg.m_Size * 8)) - 1;
         }
+
+        rv = (sums == sumr);
     }
 
     // get what should be the checksum package end marker
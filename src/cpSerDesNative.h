@@ -15,6 +15,7 @@
 //  2011-05-16  asc Creation.
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2012-11-30  asc Added additional native data types for function call support.
+//  2026-10-16  asc Decoded numeric fields in place in the stream.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_SERDESNATIVE_H
@@ -103,6 +104,7 @@ private:
     bool LongLongExtract(uint64_t &Val);                    // decode a long long from the input stream
     bool Float32Extract(float &Val);                        // decode a single float from the input stream
     bool Float64Extract(double &Val);                       // decode a double float from the input stream
+    bool FieldExtract(void *pVal, size_t Size);             // decode a fixed-size field from the input stream
     bool StringExtract(String &Str);                        // decode a string from the input stream
     bool BlobExtract(Buffer &Buf);                          // decode a BLOB from the input stream
     bool VariantExtract(Variant &Var,
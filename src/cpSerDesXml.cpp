@@ -18,6 +18,8 @@
 //  2013-06-07  asc Corrected extraction handling of dt_none elements.
 //  2013-11-15  asc Restructured to align with IDL ser/des.
 //  2013-11-15  asc Fixed handling of checksum calculations.
+//  2026-10-16  asc Moved decoded blobs into the variant.
+//  2026-10-16  asc Formatted numbers into local buffers instead of string streams.
 // ----------------------------------------------------------------------------
 
 #include <sstream>
@@ -303,73 +305,89 @@ bool SerDesXml::NewLineInsert()
 // encode an unsigned long into the output buffer
 bool SerDesXml::UnsignedLongInsert(uint32_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, UintToChars(buf, Val));
 }
 
 
 // encode a signed long into the output buffer
 bool SerDesXml::SignedLongInsert(int32_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, IntToChars(buf, Val));
 }
 
 
 // encode an unsigned long long into the output buffer
 bool SerDesXml::UnsignedLongLongInsert(uint64_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, UintToChars(buf, Val));
 }
 
 
 // encode a signed long long into the output buffer
 bool SerDesXml::SignedLongLongInsert(int64_t Val)
 {
-    std::stringstream ss;
-    ss << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    return CharsInsert(buf, IntToChars(buf, Val));
 }
 
 
 // encode a single float into the output buffer
 bool SerDesXml::Float32Insert(float Val)
 {
-    std::stringstream ss;
-    ss.precision(k_FloatDigits);
-    ss << std::fixed << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    // the shortest text that reads back as the same value
+    return CharsInsert(buf, FloatToChars(buf, Val));
 }
 
 
 // encode a double float into the output buffer
 bool SerDesXml::Float64Insert(double Val)
 {
-    std::stringstream ss;
-    ss.precision(k_DoubleDigits);
-    ss << std::fixed << Val;
-    return StringInsert(ss.str().c_str());
+    char buf[k_NumTextLen];
+
+    // the shortest text that reads back as the same value
+    return CharsInsert(buf, FloatToChars(buf, Val));
 }
 
 
 // encode a string into the output buffer
 bool SerDesXml::StringInsert(String const &Str)
 {
+    return CharsInsert(Str.c_str(), Str.size());
+}
+
+
+// encode a run of characters into the output buffer
+bool SerDesXml::CharsInsert(char const *pStr, size_t Len)
+{
+    static char const blanks[] = "                                ";
     bool rv = (m_PtrStream != NULL);
-    size_t size = Str.size();
 
     if (m_NewLine)
     {
         size_t indent = m_IndentSize * m_IndentLevel;
-        rv = rv && (m_PtrStream->ArrayWr(GenStr(indent, ' ').c_str(), indent) == indent);
+
+        // indent from a run of blanks instead of building a string
+        while (rv && (indent > 0))
+        {
+            size_t size = (indent < (sizeof(blanks) - 1)) ? indent : (sizeof(blanks) - 1);
+
+            rv = (m_PtrStream->ArrayWr(blanks, size) == size);
+            indent -= size;
+        }
+
         m_NewLine = false;
     }
 
-    rv = rv && (m_PtrStream->ArrayWr(Str.c_str(), size) == size);
+    rv = rv && (m_PtrStream->ArrayWr(pStr, Len) == Len);
 
     return rv;
 }
@@ -490,11 +508,11 @@ bool SerDesXml::VariantExtract(Variant &Var, Variant::DataType_t Type, String co
         break;
 
     case Variant::dt_int64:
-        Var.Int64Set(StrToInt(Value));
+        Var.Int64Set(StrToInt64(Value));
         break;
 
     case Variant::dt_uint64:
-        Var.Uint64Set(StrToUint(Value));
+        Var.Uint64Set(StrToUint64(Value));
         break;
 
     case Variant::dt_float32:
@@ -517,7 +535,7 @@ bool SerDesXml::VariantExtract(Variant &Var, Variant::DataType_t Type, String co
         {
             Buffer buf;
             HexDecode(Value, buf);
-            Var.BufSet(buf);
+            Var.BufSet(std::move(buf));
         }
         break;
 
@@ -16,6 +16,7 @@
 //  2012-08-10  asc Moved identifiers to cp namespace.
 //  2012-11-30  asc Added additional native data types for function call support.
 //  2013-11-15  asc Restructured to align with IDL ser/des.
+//  2026-10-16  asc Added CharsInsert().
 // ----------------------------------------------------------------------------
 
 #ifndef CP_SERDESXML_H
@@ -73,6 +74,7 @@ private:
     bool Float32Insert(float Val);                          // encode a single float into the output buffer
     bool Float64Insert(double Val);                         // encode a double float into the output buffer
     bool StringInsert(String const &Str);                   // encode a string into the output buffer
+    bool CharsInsert(char const *pStr, size_t Len);         // encode a run of characters into the output buffer
     bool BlobInsert(Buffer const &Buf);                     // encode a BLOB into the output buffer
 
     bool OpenTagInsert(String const &TagName, bool Attribute = false);
@@ -0,0 +1,536 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpSimd.cpp
+//
+//  Description:    Vector Kernels and CPU Feature Detection.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added carry-less multiply CRC-32 folding.
+//  2026-10-16  asc Added hex encoding and decoding.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "cpSimd.h"
+#include "cpUtil.h"
+
+#if defined(CP_SIMD_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+namespace cp
+{
+
+// ----------------------------------------------------------------------------
+// feature detection
+// ----------------------------------------------------------------------------
+
+#if (defined(CP_SIMD_X86) && defined(_MSC_VER))
+// return a cpuid register bit
+static bool CpuIdBit(int Leaf, int Reg, int Bit)
+{
+    int regs[4];
+
+    __cpuidex(regs, Leaf, 0);
+
+    return ((regs[Reg] >> Bit) & 1) != 0;
+}
+#endif
+
+
+// determine if the CPU supports SSSE3 byte shuffles
+bool CpuSsse3()
+{
+#if (defined(CP_SIMD_X86) && defined(__GNUC__))
+    static bool const rv = __builtin_cpu_supports("ssse3");
+#elif defined(CP_SIMD_X86)
+    static bool const rv = CpuIdBit(1, 2, 9);
+#else
+    static bool const rv = false;
+#endif
+
+    return rv;
+}
+
+
+// determine if the CPU and operating system support AVX2
+bool CpuAvx2()
+{
+#if (defined(CP_SIMD_X86) && defined(__GNUC__))
+    static bool const rv = __builtin_cpu_supports("avx2");
+#elif defined(CP_SIMD_X86)
+    // the operating system must also save the ymm registers
+    static bool const rv = CpuIdBit(1, 2, 27) && CpuIdBit(1, 2, 28) &&
+                           ((_xgetbv(0) & 6) == 6) && CpuIdBit(7, 1, 5);
+#else
+    static bool const rv = false;
+#endif
+
+    return rv;
+}
+
+
+// determine if the CPU supports carry-less multiplication and SSE4.1
+bool CpuPclmul()
+{
+#if (defined(CP_SIMD_X86) && defined(__GNUC__))
+    static bool const rv = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#elif defined(CP_SIMD_X86)
+    static bool const rv = CpuIdBit(1, 2, 1) && CpuIdBit(1, 2, 19);
+#else
+    static bool const rv = false;
+#endif
+
+    return rv;
+}
+
+// ----------------------------------------------------------------------------
+// byte swapping
+// ----------------------------------------------------------------------------
+
+#if defined(CP_SIMD_X86)
+// build a shuffle mask that reverses each Size octet element
+static void SwapMask(uint8_t *pMask, size_t Len, size_t Size)
+{
+    size_t i;
+
+    for (i = 0; i < Len; ++i)
+    {
+        pMask[i] = static_cast<uint8_t>((i - (i % Size)) + (Size - 1 - (i % Size)));
+    }
+}
+
+
+// swap 16 octets at a time, returning the number of octets done
+CP_TARGET("ssse3")
+static size_t SwapSsse3(uint8_t *pDst, uint8_t const *pSrc, size_t Len, size_t Size)
+{
+    uint8_t mask[16];
+    size_t i = 0;
+
+    SwapMask(mask, sizeof(mask), Size);
+
+    __m128i shuf = _mm_loadu_si128(reinterpret_cast<__m128i const *>(mask));
+
+    for (i = 0; (i + 16) <= Len; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst + i), _mm_shuffle_epi8(v, shuf));
+    }
+
+    return i;
+}
+
+
+// swap 32 octets at a time, returning the number of octets done
+CP_TARGET("avx2")
+static size_t SwapAvx2(uint8_t *pDst, uint8_t const *pSrc, size_t Len, size_t Size)
+{
+    uint8_t mask[32];
+    size_t i = 0;
+
+    // the shuffle works within each 16 octet lane, so both lanes get the same mask
+    SwapMask(mask, 16, Size);
+    memcpy(mask + 16, mask, 16);
+
+    __m256i shuf = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(mask));
+
+    for (i = 0; (i + 32) <= Len; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pSrc + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + i), _mm256_shuffle_epi8(v, shuf));
+    }
+
+    // one more half width pass, if it fits
+    if ((i + 16) <= Len)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst + i),
+                         _mm_shuffle_epi8(v, _mm256_castsi256_si128(shuf)));
+        i += 16;
+    }
+
+    return i;
+}
+#endif
+
+
+// swap with the best available vector kernel, returning the number of octets done
+static size_t SwapVector(uint8_t *pDst, uint8_t const *pSrc, size_t Len, size_t Size)
+{
+#if defined(CP_SIMD_X86)
+    if (CpuAvx2())
+    {
+        return SwapAvx2(pDst, pSrc, Len, Size);
+    }
+
+    if (CpuSsse3())
+    {
+        return SwapSsse3(pDst, pSrc, Len, Size);
+    }
+#else
+    (void)pDst;
+    (void)pSrc;
+    (void)Len;
+    (void)Size;
+#endif
+
+    return 0;
+}
+
+
+// copy an array of short words, swapping the bytes in each (may be in place)
+void SwapArray16(void *pDst, void const *pSrc, size_t Count)
+{
+    uint8_t *pD = static_cast<uint8_t *>(pDst);
+    uint8_t const *pS = static_cast<uint8_t const *>(pSrc);
+    size_t i = SwapVector(pD, pS, Count * sizeof(uint16_t), sizeof(uint16_t));
+    uint16_t val;
+
+    // finish the tail one element at a time
+    for (; i < (Count * sizeof(uint16_t)); i += sizeof(uint16_t))
+    {
+        memcpy(&val, pS + i, sizeof(val));
+        val = static_cast<uint16_t>((val << 8) | (val >> 8));
+        memcpy(pD + i, &val, sizeof(val));
+    }
+}
+
+
+// copy an array of long words, swapping the bytes in each (may be in place)
+void SwapArray32(void *pDst, void const *pSrc, size_t Count)
+{
+    uint8_t *pD = static_cast<uint8_t *>(pDst);
+    uint8_t const *pS = static_cast<uint8_t const *>(pSrc);
+    size_t i = SwapVector(pD, pS, Count * sizeof(uint32_t), sizeof(uint32_t));
+    uint32_t val;
+
+    // finish the tail one element at a time
+    for (; i < (Count * sizeof(uint32_t)); i += sizeof(uint32_t))
+    {
+        memcpy(&val, pS + i, sizeof(val));
+        val = ((val >> 24) | (val << 24) |
+               ((val >> 8) & 0x0000ff00) | ((val << 8) & 0x00ff0000));
+        memcpy(pD + i, &val, sizeof(val));
+    }
+}
+
+
+// copy an array of long long words, swapping the bytes in each (may be in place)
+void SwapArray64(void *pDst, void const *pSrc, size_t Count)
+{
+    uint8_t *pD = static_cast<uint8_t *>(pDst);
+    uint8_t const *pS = static_cast<uint8_t const *>(pSrc);
+    size_t i = SwapVector(pD, pS, Count * sizeof(uint64_t), sizeof(uint64_t));
+    uint64_t val;
+
+    // finish the tail one element at a time
+    for (; i < (Count * sizeof(uint64_t)); i += sizeof(uint64_t))
+    {
+        memcpy(&val, pS + i, sizeof(val));
+        val = ((val & 0x00000000ffffffffull) << 32) | ((val & 0xffffffff00000000ull) >> 32);
+        val = ((val & 0x0000ffff0000ffffull) << 16) | ((val & 0xffff0000ffff0000ull) >> 16);
+        val = ((val & 0x00ff00ff00ff00ffull) << 8)  | ((val & 0xff00ff00ff00ff00ull) >> 8);
+        memcpy(pD + i, &val, sizeof(val));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// CRC-32
+// ----------------------------------------------------------------------------
+
+#if defined(CP_SIMD_X86)
+// update a reflected CRC-32 state by folding with carry-less multiplication
+// (the folding constants are powers of x modulo the reflected 0x04c11db7
+// generator, as described in Intel's "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction")
+CP_TARGET("pclmul,sse4.1")
+uint32_t Crc32Pclmul(uint32_t Crc, uint8_t const *pBuf, size_t Len)
+{
+    alignas(16) static uint64_t const k1k2[2] = { 0x0154442bd4ull, 0x01c6e41596ull };
+    alignas(16) static uint64_t const k3k4[2] = { 0x01751997d0ull, 0x00ccaa009eull };
+    alignas(16) static uint64_t const k5k0[2] = { 0x0163cd6124ull, 0x0000000000ull };
+    alignas(16) static uint64_t const poly[2] = { 0x01db710641ull, 0x01f7011641ull };
+
+    __m128i const *pIn = reinterpret_cast<__m128i const *>(pBuf);
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    // load the first 64 octets into four lanes and mix in the state
+    x1 = _mm_xor_si128(_mm_loadu_si128(pIn), _mm_cvtsi32_si128(static_cast<int>(Crc)));
+    x2 = _mm_loadu_si128(pIn + 1);
+    x3 = _mm_loadu_si128(pIn + 2);
+    x4 = _mm_loadu_si128(pIn + 3);
+    pIn += 4;
+    Len -= 64;
+
+    // fold each lane forward by 64 octets at a time
+    x0 = _mm_load_si128(reinterpret_cast<__m128i const *>(k1k2));
+
+    while (Len >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(pIn));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(pIn + 1));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(pIn + 2));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(pIn + 3));
+
+        pIn += 4;
+        Len -= 64;
+    }
+
+    // fold the four lanes into one
+    x0 = _mm_load_si128(reinterpret_cast<__m128i const *>(k3k4));
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // fold in any remaining 16 octet units
+    while (Len >= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(pIn)), x5);
+
+        ++pIn;
+        Len -= 16;
+    }
+
+    // reduce 128 bits to 64
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(k5k0));
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduce 64 bits to the 32 bit remainder
+    x0 = _mm_load_si128(reinterpret_cast<__m128i const *>(poly));
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// hex conversion
+// ----------------------------------------------------------------------------
+
+// lower case hex digits
+static char const k_HexDigits[] = "0123456789abcdef";
+
+#if defined(CP_SIMD_X86)
+// encode 16 octets at a time, returning the number of octets done
+CP_TARGET("ssse3")
+static size_t HexEncSsse3(char *pDst, uint8_t const *pSrc, size_t Count)
+{
+    __m128i const digits = _mm_loadu_si128(reinterpret_cast<__m128i const *>(k_HexDigits));
+    __m128i const nibble = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (i = 0; (i + 16) <= Count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + i));
+        __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+        __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(v, nibble));
+
+        // interleave so each high digit precedes its low digit
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst + (2 * i)), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst + (2 * i) + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return i;
+}
+
+
+// encode 32 octets at a time, returning the number of octets done
+CP_TARGET("avx2")
+static size_t HexEncAvx2(char *pDst, uint8_t const *pSrc, size_t Count)
+{
+    __m256i const digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(k_HexDigits)));
+    __m256i const nibble = _mm256_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (i = 0; (i + 32) <= Count; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pSrc + i));
+        __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(v, nibble));
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+
+        // the unpacks work within each 16 octet lane, so put the halves back in order
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + (2 * i)), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pDst + (2 * i) + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return i;
+}
+
+
+// decode 8 octets at a time, returning the number of octets done
+CP_TARGET("ssse3")
+static size_t HexDecSsse3(uint8_t *pDst, char const *pSrc, size_t Count)
+{
+    size_t i = 0;
+
+    for (i = 0; (i + 8) <= Count; i += 8)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(pSrc + (2 * i)));
+
+        // digits map to 0-9 and letters of either case to 0-5, anything else is out of range
+        __m128i dig = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+        __m128i let = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        __m128i isDig = _mm_cmpeq_epi8(_mm_min_epu8(dig, _mm_set1_epi8(9)), dig);
+        __m128i isLet = _mm_cmpeq_epi8(_mm_min_epu8(let, _mm_set1_epi8(5)), let);
+
+        if (_mm_movemask_epi8(_mm_or_si128(isDig, isLet)) != 0xffff)
+        {
+            break;
+        }
+
+        // combine each pair of nibbles into an octet
+        __m128i nib = _mm_or_si128(_mm_and_si128(isDig, dig),
+                                   _mm_and_si128(isLet, _mm_add_epi8(let, _mm_set1_epi8(10))));
+        __m128i oct = _mm_maddubs_epi16(nib, _mm_set1_epi16(0x0110));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(pDst + i), _mm_packus_epi16(oct, oct));
+    }
+
+    return i;
+}
+
+
+// decode 16 octets at a time, returning the number of octets done
+CP_TARGET("avx2")
+static size_t HexDecAvx2(uint8_t *pDst, char const *pSrc, size_t Count)
+{
+    size_t i = 0;
+
+    for (i = 0; (i + 16) <= Count; i += 16)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(pSrc + (2 * i)));
+
+        // digits map to 0-9 and letters of either case to 0-5, anything else is out of range
+        __m256i dig = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        __m256i let = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        __m256i isDig = _mm256_cmpeq_epi8(_mm256_min_epu8(dig, _mm256_set1_epi8(9)), dig);
+        __m256i isLet = _mm256_cmpeq_epi8(_mm256_min_epu8(let, _mm256_set1_epi8(5)), let);
+
+        if (_mm256_movemask_epi8(_mm256_or_si256(isDig, isLet)) != -1)
+        {
+            break;
+        }
+
+        // combine each pair of nibbles into an octet, then gather the two lanes' results
+        __m256i nib = _mm256_or_si256(_mm256_and_si256(isDig, dig),
+                                      _mm256_and_si256(isLet, _mm256_add_epi8(let, _mm256_set1_epi8(10))));
+        __m256i oct = _mm256_maddubs_epi16(nib, _mm256_set1_epi16(0x0110));
+        __m256i pak = _mm256_permute4x64_epi64(_mm256_packus_epi16(oct, oct), 0xd8);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pDst + i), _mm256_castsi256_si128(pak));
+    }
+
+    return i;
+}
+#endif
+
+
+// convert an array of octets to pairs of lower case hex digits
+void HexEncodeArray(char *pDst, uint8_t const *pSrc, size_t Count)
+{
+    size_t i = 0;
+
+#if defined(CP_SIMD_X86)
+    if (CpuAvx2())
+    {
+        i = HexEncAvx2(pDst, pSrc, Count);
+    }
+
+    if (CpuSsse3())
+    {
+        i += HexEncSsse3(pDst + (2 * i), pSrc + i, Count - i);
+    }
+#endif
+
+    // finish the tail one octet at a time
+    for (; i < Count; ++i)
+    {
+        pDst[2 * i] = k_HexDigits[pSrc[i] >> 4];
+        pDst[(2 * i) + 1] = k_HexDigits[pSrc[i] & 0x0f];
+    }
+}
+
+
+// convert up to Count pairs of hex digits to octets
+size_t HexDecodeArray(uint8_t *pDst, char const *pSrc, size_t Count)
+{
+    size_t i = 0;
+
+#if defined(CP_SIMD_X86)
+    if (CpuAvx2())
+    {
+        i = HexDecAvx2(pDst, pSrc, Count);
+    }
+
+    if (CpuSsse3())
+    {
+        i += HexDecSsse3(pDst + i, pSrc + (2 * i), Count - i);
+    }
+#endif
+
+    // finish the tail, or find the pair that stopped the vector kernel
+    for (; i < Count; ++i)
+    {
+        int hi = HexDigitVal(pSrc[2 * i]);
+        int lo = HexDigitVal(pSrc[(2 * i) + 1]);
+
+        if ((hi < 0) || (lo < 0))
+        {
+            break;
+        }
+
+        pDst[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+
+    return i;
+}
+
+}   // namespace cp
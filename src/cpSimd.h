@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpSimd.h
+//
+//  Description:    Vector Kernels and CPU Feature Detection.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+//  2026-10-16  asc Added carry-less multiply CRC-32 folding.
+//  2026-10-16  asc Added hex encoding and decoding.
+// ----------------------------------------------------------------------------
+
+#ifndef CP_SIMD_H
+#define CP_SIMD_H
+
+#include "cpPlatform.h"
+
+// ----------------------------------------------------------------------------
+// Kernels in this module are selected at run time from the instruction set
+// extensions the CPU reports, so the library is still built for the baseline
+// architecture.  Each kernel has a portable scalar path that is used on other
+// architectures and on CPUs without the extension.  On x86 with GCC or Clang
+// the vector paths are compiled with per-function target attributes; with
+// MSVC the intrinsics are available without them.
+// ----------------------------------------------------------------------------
+
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#define CP_SIMD_X86
+#define CP_TARGET(Isa) __attribute__((target(Isa)))
+#elif (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define CP_SIMD_X86
+#define CP_TARGET(Isa)
+#endif
+
+namespace cp
+{
+
+// determine if the CPU supports SSSE3 byte shuffles
+bool CpuSsse3();
+
+// determine if the CPU and operating system support AVX2
+bool CpuAvx2();
+
+// determine if the CPU supports carry-less multiplication and SSE4.1
+bool CpuPclmul();
+
+// copy an array of short words, swapping the bytes in each (may be in place)
+void SwapArray16(void *pDst, void const *pSrc, size_t Count);
+
+// copy an array of long words, swapping the bytes in each (may be in place)
+void SwapArray32(void *pDst, void const *pSrc, size_t Count);
+
+// copy an array of long long words, swapping the bytes in each (may be in place)
+void SwapArray64(void *pDst, void const *pSrc, size_t Count);
+
+// convert an array of octets to pairs of lower case hex digits
+// (pDst receives 2 * Count characters and no terminator)
+void HexEncodeArray(char *pDst, uint8_t const *pSrc, size_t Count);
+
+// convert up to Count pairs of hex digits to octets, stopping at the first
+// pair that is not two hex digits, and return the number of octets produced
+size_t HexDecodeArray(uint8_t *pDst, char const *pSrc, size_t Count);
+
+#if defined(CP_SIMD_X86)
+// update a reflected CRC-32 state by folding with carry-less multiplication
+// (requires CpuPclmul(), Len must be a multiple of 16 and at least 64)
+uint32_t Crc32Pclmul(uint32_t Crc, uint8_t const *pBuf, size_t Len);
+#endif
+
+}   // namespace cp
+
+#endif  // CP_SIMD_H
@@ -21,21 +21,60 @@
 //  2013-08-29  asc Refactored Clear() operation to eliminate pitfalls.
 //  2013-11-15  asc Implemented CRC calculation.
 //  2022-03-15  asc Added flag to return terminator, if present, with ReadLine().
+//  2026-10-16  asc Added BufferView read and write.
+//  2026-10-16  asc Skipped zero fill of the Read() target buffer.
+//  2026-10-16  asc Cached cumulative block offsets for position queries and seeks.
+//  2026-10-16  asc Added contiguous span reserve/commit and peek/consume.
+//  2026-10-16  asc Added bulk typed array insertion and extraction.
+//  2026-10-16  asc Added incremental and multi-threaded CRC-32 calculation.
+//  2026-10-16  asc Added CRC-16 and 64-bit hash calculation.
+//  2026-10-16  asc Implemented HexLoad().
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "cpStreamBase.h"
 #include "cpBuffer.h"
+#include "cpCrc.h"
+#include "cpHash.h"
+#include "cpSimd.h"
 #include "cpUtil.h"
 
 namespace cp
 {
 
+// copy an array of fields, swapping the octets in each
+static void FieldsSwap(void *pDst, void const *pSrc, size_t Count, size_t Size)
+{
+    switch (Size)
+    {
+    case sizeof(uint16_t):
+        SwapArray16(pDst, pSrc, Count);
+        break;
+
+    case sizeof(uint32_t):
+        SwapArray32(pDst, pSrc, Count);
+        break;
+
+    case sizeof(uint64_t):
+        SwapArray64(pDst, pSrc, Count);
+        break;
+
+    default:
+        memcpy(pDst, pSrc, Count * Size);
+        break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 // constructor
 StreamBase::StreamBase() :
     m_CurBlock(0),
     m_CurPos(0),
     m_LastBlock(0),
-    m_LastPos(0)
+    m_LastPos(0),
+    m_CrcTrack(false)
 {
 }
 
@@ -85,52 +124,23 @@ bool StreamBase::Readable()
 // return the current stream position
 size_t StreamBase::Pos() const
 {
-    uint32_t i = 0;
-    size_t pos = 0;
-
-    while (i < m_CurBlock)
-    {
-        pos += BlockSize(i);
-        ++i;
-    }
-
-    pos += m_CurPos;
-
-    return pos;
+    return BlockOffset(m_CurBlock) + m_CurPos;
 }
 
 
 // return the stream data size
 size_t StreamBase::LenGet() const
 {
-    uint32_t i = 0;
-    size_t len = 0;
-
-    while (i < m_LastBlock)
-    {
-        len += BlockSize(i);
-        ++i;
-    }
-
-    len += m_LastPos;
-
-    return len;
+    return BlockOffset(m_LastBlock) + m_LastPos;
 }
 
 
 // return the stream buffer size
 size_t StreamBase::BufSize() const
 {
-    uint32_t i = 0;
-    size_t size = 0;
-
-    while (ValidBlock(i))
-    {
-        size += BlockSize(i);
-        ++i;
-    }
+    OffsetSync();
 
-    return size;
+    return m_Offsets.back();
 }
 
 
@@ -235,6 +245,8 @@ size_t StreamBase::ArrayWr(char const *pBuf, size_t Len)
         }
     }
 
+    CrcInvalidate(m_CurBlock);
+
     // loop until write request fulfilled
     while (leftToWrite > 0)
     {
@@ -294,18 +306,7 @@ size_t StreamBase::ArrayWr(char const *pBuf, size_t Len)
     }
 
     // adjust pointers
-    if (m_LastBlock < m_CurBlock)
-    {
-        m_LastBlock = m_CurBlock;
-        m_LastPos = m_CurPos;
-    }
-    else if (m_LastBlock == m_CurBlock)
-    {
-        if (m_LastPos < m_CurPos)
-        {
-            m_LastPos = m_CurPos;
-        }
-    }
+    EndExtend();
 
     return numWritten;
 }
@@ -336,7 +337,7 @@ size_t StreamBase::Read(Buffer &Buf, size_t Len)
     // since user may have purposely allocated a larger buffer
     if (Buf.Size() < length)
     {
-        status = Buf.Resize(length);
+        status = Buf.Resize(length, false);
     }
 
     if (status)
@@ -368,6 +369,62 @@ size_t StreamBase::Write(Buffer const &Buf, size_t Len)
 }
 
 
+// view up to Len contiguous octets in place
+// (the view ends at a block boundary and is valid until the stream changes)
+size_t StreamBase::Read(BufferView &View, size_t Len)
+{
+    size_t readSize = 0;
+    char *addr = NULL;
+
+    View.Clear();
+
+    if ((Len == 0) || (Readable() == false))
+    {
+        return 0;
+    }
+
+    // determine how much is contiguous in this block
+    readSize = ReadSpan();
+
+    // adjust read size if greater than requested
+    if (readSize > Len)
+    {
+        readSize = Len;
+    }
+
+    if (readSize > 0)
+    {
+        addr = BlockMemPtr(m_CurBlock);
+
+        if (addr == NULL)
+        {
+            LogErr << "StreamBase()::Read(): Invalid Address, instance: "
+                   << this << std::endl;
+            return 0;
+        }
+
+        View = BufferView(addr + m_CurPos, readSize);
+        m_CurPos += readSize;
+    }
+
+    return readSize;
+}
+
+
+// write up to Len octets to stream
+size_t StreamBase::Write(BufferView const &View, size_t Len)
+{
+    size_t length = View.LenGet();
+
+    if (length > Len)
+    {
+        length = Len;
+    }
+
+    return ArrayWr(View.c_str(), length);
+}
+
+
 // read one octet from stream
 bool StreamBase::Read(uint8_t &Ch)
 {
@@ -396,6 +453,99 @@ bool StreamBase::Write(char Ch)
 }
 
 
+// return Len contiguous writable octets at the position, or NULL
+// (the span is valid until the stream changes and is written by Commit())
+char *StreamBase::Reserve(size_t Len)
+{
+    char *addr = NULL;
+
+    if (Len == 0)
+    {
+        return NULL;
+    }
+
+    // make sure at least one block is allocated
+    if ((MemoryChk() == false) && (MemoryAdd(Len) == false))
+    {
+        return NULL;
+    }
+
+    // a span cannot start at the end of a block
+    if (BlockAdvance(Len) == false)
+    {
+        return NULL;
+    }
+
+    CrcInvalidate(m_CurBlock);
+
+    // the span must fit in the rest of the block
+    if (Len <= (BlockSize(m_CurBlock) - m_CurPos))
+    {
+        addr = BlockMemPtr(m_CurBlock);
+    }
+
+    return addr ? (addr + m_CurPos) : NULL;
+}
+
+
+// advance past Len octets written to a reserved span
+bool StreamBase::Commit(size_t Len)
+{
+    if (Len == 0)
+    {
+        return true;
+    }
+
+    // the octets must have been reserved in the current block
+    if ((ValidBlock(m_CurBlock) == false) || (Len > (BlockSize(m_CurBlock) - m_CurPos)))
+    {
+        LogErr << "StreamBase::Commit(): Commit of " << Len
+               << " octets exceeds the reserved span, instance: " << this << std::endl;
+        return false;
+    }
+
+    m_CurPos += Len;
+    EndExtend();
+
+    return true;
+}
+
+
+// return Len contiguous readable octets at the position, or NULL
+// (the span is valid until the stream changes and is read by Consume())
+char const *StreamBase::Peek(size_t Len)
+{
+    char *addr = NULL;
+
+    if ((Len == 0) || (Readable() == false))
+    {
+        return NULL;
+    }
+
+    // the span must be held by a single block
+    if (Len <= ReadSpan())
+    {
+        addr = BlockMemPtr(m_CurBlock);
+    }
+
+    return addr ? (addr + m_CurPos) : NULL;
+}
+
+
+// advance past Len octets read from a peeked span
+bool StreamBase::Consume(size_t Len)
+{
+    // common case: the octets are in the current block
+    if (Len <= ReadSpan())
+    {
+        m_CurPos += Len;
+        return true;
+    }
+
+    return Skip(Len);
+}
+
+
 // read until terminator or buf size
 bool StreamBase::ReadLine(String &Line, char Term, bool DiscardTerm)
 {
@@ -528,20 +678,67 @@ bool StreamBase::BinLoad(std::istream &In)
 
 
 // hex load contents from an ostream object
+// (lines in HexDump() format are read from their octet columns and any
+// other lines are decoded as hex digits, ignoring separators)
 bool StreamBase::HexLoad(std::istream &In)
 {
-    // (.)(.) need to implement HexLoad()
-    (void)In;
-    return false;
+    bool rv = true;
+    size_t pos = 0;
+    size_t len = 0;
+    String line;
+    Buffer buf;
+
+    // clear the stream
+    Clear();
+
+    // read the data in a line at a time
+    while (rv && std::getline(In, line))
+    {
+        // a dump line starts with an offset of at least four hex digits and ": "
+        pos = 0;
+
+        while ((pos < line.size()) && (cp::HexDigitVal(line[pos]) >= 0))
+        {
+            ++pos;
+        }
+
+        if ((pos >= 4) && (line.compare(pos, 2, ": ") == 0))
+        {
+            // each octet column is a space and two hex digits
+            buf.Resize(line.size() / 3, false);
+            len = 0;
+            pos += 2;
+
+            while (((pos + 2) < line.size()) && (line[pos] == ' ') &&
+                   (cp::HexDigitVal(line[pos + 1]) >= 0) && (cp::HexDigitVal(line[pos + 2]) >= 0))
+            {
+                *buf.u_str(len++) = static_cast<uint8_t>((cp::HexDigitVal(line[pos + 1]) << 4) |
+                                                         cp::HexDigitVal(line[pos + 2]));
+                pos += 3;
+            }
+
+            buf.LenSet(len);
+        }
+        else
+        {
+            len = cp::HexDecode(line, buf);
+        }
+
+        rv = (Write(buf, len) == len);
+    }
+
+    return rv;
 }
 
 
 // calculate the CRC-32 of the buffer contents
-uint32_t StreamBase::Crc32Get(size_t Len)
+// (Workers greater than one shares a long calculation among that many threads)
+uint32_t StreamBase::Crc32Get(size_t Len, size_t Workers)
 {
-    uint32_t i = 0;
+    size_t whole = 0;
+    size_t i = 0;
     size_t size = 0;
-    uint32_t cascade = 0xffffffff;
+    uint32_t crc = 0xffffffff;
 
     // length of 0 means use the entire stream
     if (Len == 0)
@@ -549,22 +746,111 @@ uint32_t StreamBase::Crc32Get(size_t Len)
         Len = LenGet();
     }
 
-    while (ValidBlock(i) && (Len > 0))
+    if ((Len == 0) || (ValidBlock(0) == false))
     {
-        size = BlockSize(i);
+        return crc;
+    }
+
+    // count the blocks of data that lie entirely within the length
+    OffsetSync();
+    whole = std::upper_bound(m_Offsets.begin(), m_Offsets.end(), Len) - m_Offsets.begin() - 1;
+
+    if (whole > m_LastBlock)
+    {
+        whole = m_LastBlock;
+    }
+
+    // start from the longest cached run of whole blocks
+    if (m_Crcs.empty())
+    {
+        m_Crcs.push_back(crc);
+    }
+
+    i = (m_Crcs.size() > whole) ? whole : (m_Crcs.size() - 1);
+    crc = m_Crcs[i];
+    Len -= m_Offsets[i];
+
+    if (Workers > 1)
+    {
+        BufferViewVec_t views;
 
-        // trim if less than full stream was requested
-        if (size > Len)
+        // hand the rest to the worker threads as views of the blocks
+        while (ValidBlock(i) && (Len > 0))
         {
-            size = Len;
+            size = (BlockSize(i) > Len) ? Len : BlockSize(i);
+            views.push_back(BufferView(BlockMemPtr(i), size));
+            ++i;
+            Len -= size;
         }
 
-        cascade = cp::CalcCrc32(BlockMemPtr(i), size, cascade);
+        return cp::Crc32Parallel(crc, views, Workers) ^ 0xffffffff;
+    }
+
+    // remember the whole blocks for next time
+    CrcSync(whole);
+    crc = m_Crcs[whole];
+    Len -= m_Offsets[whole] - m_Offsets[i];
+    i = whole;
+
+    while (ValidBlock(i) && (Len > 0))
+    {
+        size = (BlockSize(i) > Len) ? Len : BlockSize(i);
+        crc = cp::Crc32Update(crc, reinterpret_cast<uint8_t const *>(BlockMemPtr(i)), size);
+        ++i;
+        Len -= size;
+    }
+
+    return crc ^ 0xffffffff;
+}
+
+
+// calculate the CRC-16 of the buffer contents
+uint16_t StreamBase::Crc16Get(size_t Len)
+{
+    size_t i = 0;
+    size_t size = 0;
+    uint16_t crc = 0xffff;
+
+    // length of 0 means use the entire stream
+    if (Len == 0)
+    {
+        Len = LenGet();
+    }
+
+    while (ValidBlock(i) && (Len > 0))
+    {
+        size = (BlockSize(i) > Len) ? Len : BlockSize(i);
+        crc = cp::Crc16Update(crc, reinterpret_cast<uint8_t const *>(BlockMemPtr(i)), size);
+        ++i;
+        Len -= size;
+    }
+
+    return crc;
+}
+
+
+// calculate the 64-bit hash of the buffer contents
+uint64_t StreamBase::Hash64Get(size_t Len)
+{
+    size_t i = 0;
+    size_t size = 0;
+    Hash64 hash;
+
+    // length of 0 means use the entire stream
+    if (Len == 0)
+    {
+        Len = LenGet();
+    }
+
+    while (ValidBlock(i) && (Len > 0))
+    {
+        size = (BlockSize(i) > Len) ? Len : BlockSize(i);
+        hash.Update(BlockMemPtr(i), size);
         ++i;
         Len -= size;
     }
 
-    return cascade;
+    return hash.Final();
 }
 
 
@@ -614,6 +900,8 @@ void StreamBase::Clear()
     MemoryFree();
 
     // reset state data
+    m_Offsets.clear();
+    m_Crcs.clear();
     m_LastBlock = 0;
     m_LastPos = 0;
     m_CurBlock = 0;
@@ -624,48 +912,38 @@ void StreamBase::Clear()
 // seeks to position specified
 bool StreamBase::Seek(size_t Pos)
 {
-    size_t loc = 0;
-    size_t size = 0;
-    uint32_t i = 0;
-    bool rv = false;
+    size_t last = m_LastBlock;
 
-    while (ValidBlock(i) && !rv)
+    if (ValidBlock(0) == false)
     {
-        // if this is not the last written block
-        if (i < m_LastBlock)
-        {
-            size = BlockSize(i);
-        }
-        else if (i == m_LastBlock)
-        {
-            size = m_LastPos;
-        }
-        else
-        {
-            size = 0;
-            break;
-        }
+        return false;
+    }
 
-        // check if seek position has been found or overshot
-        if ((loc + size) >= Pos)
-        {
-            m_CurPos = Pos - loc;
-            rv = true;
-        }
-        else
-        {
-            loc += size;
-            m_CurPos = size;
-        }
+    OffsetSync();
 
-        // update the current position pointers
-        m_CurBlock = i;
+    // the last written block must be one the cache knows about
+    if (last > (m_Offsets.size() - 2))
+    {
+        last = m_Offsets.size() - 2;
+    }
 
-        // iterate
-        ++i;
+    // a position past the end of the data leaves the stream at the end
+    if (Pos > (m_Offsets[last] + m_LastPos))
+    {
+        m_CurBlock = last;
+        m_CurPos = m_LastPos;
+        return false;
     }
 
-    return rv;
+    // find the first block that ends at or beyond the position; a position
+    // on a block boundary stays at the end of the earlier block
+    StrmOffsets_t::const_iterator it =
+        std::lower_bound(m_Offsets.begin() + 1, m_Offsets.begin() + last + 1, Pos);
+
+    m_CurBlock = (it - m_Offsets.begin()) - 1;
+    m_CurPos = Pos - m_Offsets[m_CurBlock];
+
+    return true;
 }
 
 
@@ -735,12 +1013,12 @@ bool StreamBase::StringInsert(cp::String const &Str)
 
 
 // encode a BLOB into the output stream
-bool StreamBase::BlobInsert(cp::Buffer const &Buf)
+bool StreamBase::BlobInsert(cp::BufferView const &View)
 {
     bool rv = true;
-    size_t size = Buf.LenGet();
+    size_t size = View.LenGet();
 
-    rv = rv && (Write(Buf, size) == size);
+    rv = rv && (Write(View, size) == size);
 
     return rv;
 }
@@ -749,135 +1027,353 @@ bool StreamBase::BlobInsert(cp::Buffer const &Buf)
 // encode a short into the output stream
 bool StreamBase::Uint16Insert(uint16_t Val, bool NetworkOrder)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
-    bool bswap = (cp::HostBigEndian() != NetworkOrder);
+    return FieldInsert(&Val, sizeof(Val), NetworkOrder);
+}
+
+
+// encode a long into the output stream
+bool StreamBase::Uint32Insert(uint32_t Val, bool NetworkOrder)
+{
+    return FieldInsert(&Val, sizeof(Val), NetworkOrder);
+}
+
+
+// encode a long long into the output stream
+bool StreamBase::Uint64Insert(uint64_t Val, bool NetworkOrder)
+{
+    return FieldInsert(&Val, sizeof(Val), NetworkOrder);
+}
 
-    if (bswap)
+
+// encode a single float into the output stream
+bool StreamBase::Float32Insert(float Val, bool NetworkOrder)
+{
+    return FieldInsert(&Val, sizeof(Val), NetworkOrder);
+}
+
+
+// encode a double float into the output stream
+bool StreamBase::Float64Insert(double Val, bool NetworkOrder)
+{
+    return FieldInsert(&Val, sizeof(Val), NetworkOrder);
+}
+
+
+// return the number of contiguous readable octets at the position
+size_t StreamBase::ReadSpan()
+{
+    // index to the next block if the current one is exhausted
+    if ((m_CurBlock < m_LastBlock) && (m_CurPos >= BlockSize(m_CurBlock)))
     {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
+        ++m_CurBlock;
+        m_CurPos = 0;
     }
-    else
+
+    // determine how much is contiguous in this block
+    if (m_CurBlock < m_LastBlock)
     {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
+        return BlockSize(m_CurBlock) - m_CurPos;
     }
 
-    return rv;
+    return (m_CurPos < m_LastPos) ? (m_LastPos - m_CurPos) : 0;
 }
 
 
-// encode a long into the output stream
-bool StreamBase::Uint32Insert(uint32_t Val, bool NetworkOrder)
+// move the position from the end of a full block to the start of the next
+bool StreamBase::BlockAdvance(size_t Len)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
-    bool bswap = (cp::HostBigEndian() != NetworkOrder);
+    if (ValidBlock(m_CurBlock) == false)
+    {
+        return false;
+    }
 
-    if (bswap)
+    if (m_CurPos < BlockSize(m_CurBlock))
     {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
+        return true;
     }
-    else
+
+    // add a block if this is the last one
+    if ((ValidBlock(m_CurBlock + 1) == false) && (MemoryAdd(Len) == false))
+    {
+        return false;
+    }
+
+    // the end of the data moves too when it is at the same place
+    if (m_LastBlock == m_CurBlock)
+    {
+        ++m_LastBlock;
+        m_LastPos = 0;
+    }
+
+    ++m_CurBlock;
+    m_CurPos = 0;
+
+    return true;
+}
+
+
+// move the end of the data up to the current position
+void StreamBase::EndExtend()
+{
+    if (m_LastBlock < m_CurBlock)
     {
-        for (i = 0; i < sizeof(Val); ++i)
+        m_LastBlock = m_CurBlock;
+        m_LastPos = m_CurPos;
+    }
+    else if (m_LastBlock == m_CurBlock)
+    {
+        if (m_LastPos < m_CurPos)
         {
-            rv = rv && OctetInsert(pSrc[i]);
+            m_LastPos = m_CurPos;
         }
     }
 
-    return rv;
+    // fold in blocks the writer has finished with
+    if (m_CrcTrack && (m_Crcs.size() <= m_CurBlock))
+    {
+        CrcSync(m_CurBlock);
+    }
 }
 
 
-// encode a long long into the output stream
-bool StreamBase::Uint64Insert(uint64_t Val, bool NetworkOrder)
+// keep the CRC-32 up to date as blocks fill
+// (Crc32Get() then only has to process the block being written)
+void StreamBase::Crc32Track(bool Enable)
 {
-    bool rv = true;
+    m_CrcTrack = Enable;
+}
+
+
+// insert a fixed-size field into the stream
+bool StreamBase::FieldInsert(void const *pVal, size_t Size, bool NetworkOrder)
+{
+    uint8_t field[sizeof(uint64_t)];
+    uint8_t const *pSrc = static_cast<uint8_t const *>(pVal);
+    char *pDst = NULL;
     size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
-    bool bswap = (cp::HostBigEndian() != NetworkOrder);
 
-    if (bswap)
+    // arrange the octets in the requested byte order
+    if (cp::HostBigEndian() != NetworkOrder)
     {
-        for (i = sizeof(Val); i > 0; --i)
+        for (i = 0; i < Size; ++i)
         {
-            rv = rv && OctetInsert(pSrc[i-1]);
+            field[i] = pSrc[Size - i - 1];
         }
     }
     else
     {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
+        memcpy(field, pSrc, Size);
     }
 
-    return rv;
+    // store directly into the current block when the field fits
+    pDst = Reserve(Size);
+
+    if (pDst != NULL)
+    {
+        memcpy(pDst, field, Size);
+        return Commit(Size);
+    }
+
+    return (ArrayWr(field, Size) == Size);
 }
 
 
-// encode a single float into the output stream
-bool StreamBase::Float32Insert(float Val, bool NetworkOrder)
+// return the stream offset where a block starts
+size_t StreamBase::BlockOffset(size_t Block) const
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
-    bool bswap = (cp::HostBigEndian() != NetworkOrder);
+    OffsetSync();
+
+    // blocks that do not exist start at the end of the buffer
+    return (Block < m_Offsets.size()) ? m_Offsets[Block] : m_Offsets.back();
+}
 
-    if (bswap)
+
+// extend the offset cache to any added blocks
+void StreamBase::OffsetSync() const
+{
+    if (m_Offsets.empty())
     {
-        for (i = sizeof(Val); i > 0; --i)
-        {
-            rv = rv && OctetInsert(pSrc[i-1]);
-        }
+        m_Offsets.push_back(0);
     }
-    else
+
+    // the final entry is the start of the next block that may be added
+    while (ValidBlock(m_Offsets.size() - 1))
     {
-        for (i = 0; i < sizeof(Val); ++i)
-        {
-            rv = rv && OctetInsert(pSrc[i]);
-        }
+        m_Offsets.push_back(m_Offsets.back() + BlockSize(m_Offsets.size() - 1));
     }
+}
 
-    return rv;
+
+// extend the CRC cache over the leading blocks
+void StreamBase::CrcSync(size_t Blocks)
+{
+    if (m_Crcs.empty())
+    {
+        m_Crcs.push_back(0xffffffff);
+    }
+
+    // only blocks before the last one are full of data
+    if (Blocks > m_LastBlock)
+    {
+        Blocks = m_LastBlock;
+    }
+
+    while (m_Crcs.size() <= Blocks)
+    {
+        size_t block = m_Crcs.size() - 1;
+
+        m_Crcs.push_back(cp::Crc32Update(m_Crcs.back(),
+                                         reinterpret_cast<uint8_t const *>(BlockMemPtr(block)),
+                                         BlockSize(block)));
+    }
 }
 
 
-// encode a double float into the output stream
-bool StreamBase::Float64Insert(double Val, bool NetworkOrder)
+// discard CRC cache entries that cover a block
+void StreamBase::CrcInvalidate(size_t Block)
 {
-    bool rv = true;
-    size_t i = 0;
-    uint8_t *pSrc = reinterpret_cast<uint8_t *>(&Val);
-    bool bswap = (cp::HostBigEndian() != NetworkOrder);
+    // the entry for a block is the remainder before it, so it stays valid
+    if (m_Crcs.size() > (Block + 1))
+    {
+        m_Crcs.resize(Block + 1);
+    }
+}
+
+
+// insert an array of fixed-size fields into the stream
+bool StreamBase::ArrayInsert(void const *pArr, size_t Count, size_t Size, bool NetworkOrder)
+{
+    uint8_t const *pSrc = static_cast<uint8_t const *>(pArr);
+    size_t num = 0;
+
+    if ((pSrc == NULL) || (Count == 0))
+    {
+        return (Count == 0);
+    }
+
+    // fields already in the requested byte order are written as they are
+    if ((cp::HostBigEndian() == NetworkOrder) || (Size == 1))
+    {
+        return (ArrayWr(pSrc, Count * Size) == (Count * Size));
+    }
+
+    // make sure at least one block is allocated
+    if ((MemoryChk() == false) && (MemoryAdd(Count * Size) == false))
+    {
+        return false;
+    }
+
+    CrcInvalidate(m_CurBlock);
 
-    if (bswap)
+    while (Count > 0)
     {
-        for (i = sizeof(Val); i > 0; --i)
+        if (BlockAdvance(Count * Size) == false)
         {
-            rv = rv && OctetInsert(pSrc[i-1]);
+            return false;
         }
+
+        // swap as many whole fields as fit straight into the current block
+        num = (BlockSize(m_CurBlock) - m_CurPos) / Size;
+
+        if (num > Count)
+        {
+            num = Count;
+        }
+
+        if (num > 0)
+        {
+            char *addr = BlockMemPtr(m_CurBlock);
+
+            if (addr == NULL)
+            {
+                LogErr << "StreamBase()::ArrayInsert(): Invalid Address, instance: "
+                       << this << std::endl;
+                return false;
+            }
+
+            FieldsSwap(addr + m_CurPos, pSrc, num, Size);
+            m_CurPos += num * Size;
+            EndExtend();
+        }
+        else
+        {
+            // a field that straddles a block boundary is written on its own
+            num = 1;
+
+            if (FieldInsert(pSrc, Size, NetworkOrder) == false)
+            {
+                return false;
+            }
+        }
+
+        pSrc += num * Size;
+        Count -= num;
     }
-    else
+
+    return true;
+}
+
+
+// extract an array of fixed-size fields from the stream
+bool StreamBase::ArrayExtract(void *pArr, size_t Count, size_t Size, bool NetworkOrder)
+{
+    uint8_t *pDst = static_cast<uint8_t *>(pArr);
+    uint8_t field[sizeof(uint64_t)];
+    size_t num = 0;
+
+    if ((pDst == NULL) || (Count == 0))
+    {
+        return (Count == 0);
+    }
+
+    // fields already in host byte order are read as they are
+    if ((cp::HostBigEndian() == NetworkOrder) || (Size == 1))
+    {
+        return (ArrayRd(pDst, Count * Size) == (Count * Size));
+    }
+
+    while (Count > 0)
     {
-        for (i = 0; i < sizeof(Val); ++i)
+        // swap as many whole fields as the current block holds
+        num = ReadSpan() / Size;
+
+        if (num > Count)
+        {
+            num = Count;
+        }
+
+        if (num > 0)
+        {
+            char *addr = BlockMemPtr(m_CurBlock);
+
+            if (addr == NULL)
+            {
+                LogErr << "StreamBase()::ArrayExtract(): Invalid Address, instance: "
+                       << this << std::endl;
+                return false;
+            }
+
+            FieldsSwap(pDst, addr + m_CurPos, num, Size);
+            m_CurPos += num * Size;
+        }
+        else
         {
-            rv = rv && OctetInsert(pSrc[i]);
+            // a field that straddles a block boundary is gathered first
+            num = 1;
+
+            if ((Size > sizeof(field)) || (ArrayRd(field, Size) != Size))
+            {
+                return false;
+            }
+
+            FieldsSwap(pDst, field, 1, Size);
         }
+
+        pDst += num * Size;
+        Count -= num;
     }
 
-    return rv;
+    return true;
 }
 
 
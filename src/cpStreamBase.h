@@ -18,6 +18,12 @@
 //  2013-08-07  asc Replaced byte order state with separate B/L insertion methods.
 //  2013-08-29  asc Refactored Clear() operation to eliminate inheritance pitfalls.
 //  2022-03-15  asc Added flag to return terminator, if present, with ReadLine().
+//  2026-10-16  asc Added BufferView read and write.
+//  2026-10-16  asc Cached cumulative block offsets for position queries and seeks.
+//  2026-10-16  asc Added contiguous span reserve/commit and peek/consume.
+//  2026-10-16  asc Added bulk typed array insertion and extraction.
+//  2026-10-16  asc Added incremental and multi-threaded CRC-32 calculation.
+//  2026-10-16  asc Added CRC-16 and 64-bit hash calculation.
 // ----------------------------------------------------------------------------
 #ifndef CP_STREAMBASE_H
 #define CP_STREAMBASE_H
@@ -28,9 +34,26 @@ namespace cp
 {
 
 class Buffer;
+class BufferView;
+
+// local custom types
+typedef std::vector<size_t, Alloc<size_t> > StrmOffsets_t;
+typedef std::vector<uint32_t, Alloc<uint32_t> > StrmCrcs_t;
 
 // ----------------------------------------------------------------------------
 
+// Reserve() and Peek() return a pointer directly into the current block when
+// the requested octets are contiguous there, so fixed-size fields can be
+// stored or loaded in place; they return NULL when the span would cross a
+// block boundary and the caller falls back to ArrayWr() or ArrayRd().
+// Commit() and Consume() then advance the position past the octets used.
+//
+// Pos(), LenGet(), BufSize() and Seek() work from a cache of the stream offset
+// at which each block starts.  The cache is extended on the next query after
+// a derived class adds memory, so each block's size is asked for only once,
+// and it is discarded by Clear().  Derived classes must therefore only append
+// blocks, and must call Clear() before replacing or removing any.
+
 class StreamBase
 {
 public:
@@ -53,10 +76,16 @@ public:
     size_t ArrayWr(uint8_t const *pBuf, size_t Len);        // write up to Len octets to stream from array
     size_t Read(Buffer &Buf, size_t Len);                   // read up to Len octets from stream
     size_t Write(Buffer const &Buf, size_t Len);            // write up to Len octets to stream
+    size_t Read(BufferView &View, size_t Len);              // view up to Len contiguous octets in place
+    size_t Write(BufferView const &View, size_t Len);       // write up to Len octets to stream
     bool Read(uint8_t &Ch);                                 // read one octet from stream
     bool Write(uint8_t Ch);                                 // write one octet to stream
     bool Read(char &Ch);                                    // read one octet from stream
     bool Write(char Ch);                                    // write one octet to stream
+    char *Reserve(size_t Len);                              // return Len contiguous writable octets, or NULL
+    bool Commit(size_t Len);                                // advance past Len octets written to a reserved span
+    char const *Peek(size_t Len);                           // return Len contiguous readable octets, or NULL
+    bool Consume(size_t Len);                               // advance past Len octets read from a peeked span
 
     bool ReadLine(String &Line, char Term = '\n',
                   bool DiscardTerm = true);                 // read until terminator or buf size
@@ -64,7 +93,11 @@ public:
     bool HexDump(std::ostream &Out);                        // hex dump contents to an ostream object
     bool BinLoad(std::istream &In);                         // binary load contents from an ostream object
     bool HexLoad(std::istream &In);                         // hex load contents from an ostream object
-    uint32_t Crc32Get(size_t Len = 0);                      // calculate the CRC-32 of the buffer contents
+    uint32_t Crc32Get(size_t Len = 0,
+                      size_t Workers = 1);                  // calculate the CRC-32 of the buffer contents
+    bool Crc32Tracking() const { return m_CrcTrack; }       // determine if the CRC-32 is kept as blocks fill
+    uint16_t Crc16Get(size_t Len = 0);                      // calculate the CRC-16 of the buffer contents
+    uint64_t Hash64Get(size_t Len = 0);                     // calculate the 64-bit hash of the buffer contents
 
     void BlockList(std::ostream &Out);                      // list the currently allocated blocks
     void BlockDump(std::ostream &Out);                      // display contents of currently allocated blocks
@@ -74,6 +107,7 @@ public:
     virtual bool Seek(size_t Pos = 0);                      // seeks to position specified
     virtual bool Skip(size_t Num = 1);                      // skips forward by specified count
     virtual bool Back(size_t Num = 1);                      // skips backward by specified count
+    void Crc32Track(bool Enable);                           // keep the CRC-32 up to date as blocks fill
 
     // octet insertion
     bool OctetInsert(uint8_t Val)    { return Write(Val);                }
@@ -92,9 +126,37 @@ public:
     bool Float32InsertB(float Val)   { return Float32Insert(Val, true);  }
     bool Float64InsertB(double Val)  { return Float64Insert(Val, true);  }
 
+    // little endian array insertion
+    bool Uint16ArrayInsertL(uint16_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), false); }
+    bool Uint32ArrayInsertL(uint32_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), false); }
+    bool Uint64ArrayInsertL(uint64_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), false); }
+    bool Float32ArrayInsertL(float const *pArr, size_t Count)   { return ArrayInsert(pArr, Count, sizeof(*pArr), false); }
+    bool Float64ArrayInsertL(double const *pArr, size_t Count)  { return ArrayInsert(pArr, Count, sizeof(*pArr), false); }
+
+    // big endian array insertion
+    bool Uint16ArrayInsertB(uint16_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), true);  }
+    bool Uint32ArrayInsertB(uint32_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), true);  }
+    bool Uint64ArrayInsertB(uint64_t const *pArr, size_t Count) { return ArrayInsert(pArr, Count, sizeof(*pArr), true);  }
+    bool Float32ArrayInsertB(float const *pArr, size_t Count)   { return ArrayInsert(pArr, Count, sizeof(*pArr), true);  }
+    bool Float64ArrayInsertB(double const *pArr, size_t Count)  { return ArrayInsert(pArr, Count, sizeof(*pArr), true);  }
+
+    // little endian array extraction
+    bool Uint16ArrayExtractL(uint16_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), false); }
+    bool Uint32ArrayExtractL(uint32_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), false); }
+    bool Uint64ArrayExtractL(uint64_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), false); }
+    bool Float32ArrayExtractL(float *pArr, size_t Count)        { return ArrayExtract(pArr, Count, sizeof(*pArr), false); }
+    bool Float64ArrayExtractL(double *pArr, size_t Count)       { return ArrayExtract(pArr, Count, sizeof(*pArr), false); }
+
+    // big endian array extraction
+    bool Uint16ArrayExtractB(uint16_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), true);  }
+    bool Uint32ArrayExtractB(uint32_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), true);  }
+    bool Uint64ArrayExtractB(uint64_t *pArr, size_t Count)      { return ArrayExtract(pArr, Count, sizeof(*pArr), true);  }
+    bool Float32ArrayExtractB(float *pArr, size_t Count)        { return ArrayExtract(pArr, Count, sizeof(*pArr), true);  }
+    bool Float64ArrayExtractB(double *pArr, size_t Count)       { return ArrayExtract(pArr, Count, sizeof(*pArr), true);  }
+
     bool CStringInsert(cp::String const &Str);              // insert a C string into the stream
     bool StringInsert(cp::String const &Str);               // insert a string into the stream
-    bool BlobInsert(cp::Buffer const &Buf);                 // insert a binary blob into the stream
+    bool BlobInsert(cp::BufferView const &View);            // insert a binary blob into the stream
 
     // operators
 
@@ -104,6 +166,10 @@ protected:
     bool Uint64Insert(uint64_t Val, bool NetworkOrder);     // insert a long long into the stream
     bool Float32Insert(float Val, bool NetworkOrder);       // insert a float into the stream
     bool Float64Insert(double Val, bool NetworkOrder);      // insert a double into the stream
+    bool ArrayInsert(void const *pArr, size_t Count,
+                     size_t Size, bool NetworkOrder);       // insert an array of fixed-size fields into the stream
+    bool ArrayExtract(void *pArr, size_t Count,
+                      size_t Size, bool NetworkOrder);      // extract an array of fixed-size fields from the stream
 
     virtual void MemoryFree();                              // free any allocated storage
     virtual bool MemoryAdd(size_t Size);                    // add memory to the stream
@@ -116,6 +182,21 @@ protected:
     size_t              m_CurPos;                           // current stream position in current block
     size_t              m_LastBlock;                        // index to last memory block pointer
     size_t              m_LastPos;                          // last used position in last block
+
+private:
+    size_t ReadSpan();                                      // return the number of contiguous readable octets
+    bool BlockAdvance(size_t Len);                          // move from the end of a full block to the next
+    void EndExtend();                                       // move the end of the data up to the current position
+    bool FieldInsert(void const *pVal, size_t Size,
+                     bool NetworkOrder);                    // insert a fixed-size field into the stream
+    size_t BlockOffset(size_t Block) const;                 // return the stream offset where a block starts
+    void OffsetSync() const;                                // extend the offset cache to any added blocks
+    void CrcSync(size_t Blocks);                            // extend the CRC cache over the leading blocks
+    void CrcInvalidate(size_t Block);                       // discard CRC cache entries that cover a block
+
+    mutable StrmOffsets_t m_Offsets;                        // start offset of each block, then the buffer size
+    StrmCrcs_t          m_Crcs;                             // raw CRC-32 remainder before each whole block
+    bool                m_CrcTrack;                         // true when the CRC cache follows the writer
 };
 
 }   // namespace cp
@@ -17,6 +17,7 @@
 //  2013-04-22  asc Added conversion assignment operator from Buffer.
 //  2013-08-29  asc Refactored Clear() operation to eliminate inheritance pitfalls.
 //  2022-03-02  asc Added TransferBlocks() method.
+//  2026-10-16  asc Added move constructor and move assignment operator.
 // ----------------------------------------------------------------------------
 
 #include "cpStreamBuf.h"
@@ -42,6 +43,14 @@ StreamBuf::StreamBuf(StreamBuf &rhs)
 }
 
 
+// move constructor
+StreamBuf::StreamBuf(StreamBuf &&rhs)
+{
+    // invoke the move assignment operator
+    *this = std::move(rhs);
+}
+
+
 // destructor
 StreamBuf::~StreamBuf()
 {
@@ -68,6 +77,31 @@ StreamBuf &StreamBuf::operator=(StreamBuf &rhs)
 }
 
 
+// move assignment operator
+StreamBuf &StreamBuf::operator=(StreamBuf &&rhs)
+{
+    // check for self assignment
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    Clear();
+
+    // take the memory blocks and the stream state
+    m_VecBlocks.swap(rhs.m_VecBlocks);
+    m_CurBlock = rhs.m_CurBlock;
+    m_CurPos = rhs.m_CurPos;
+    m_LastBlock = rhs.m_LastBlock;
+    m_LastPos = rhs.m_LastPos;
+
+    // leave the source empty
+    rhs.Clear();
+
+    return *this;
+}
+
+
 // conversion assignment operator
 StreamBuf &StreamBuf::operator=(Buffer const &rhs)
 {
@@ -81,15 +115,7 @@ StreamBuf &StreamBuf::operator=(Buffer const &rhs)
 // transfer memory blocks from src
 void StreamBuf::TransferBlocksFrom(StreamBuf &src)
 {
-    Clear();
-    m_VecBlocks = src.m_VecBlocks;
-    // empty src vector otherwise src.Clear() will deallocate the blocks
-    src.m_VecBlocks.clear();
-    m_CurBlock = src.m_CurBlock;
-    m_CurPos = src.m_CurPos;
-    m_LastBlock = src.m_LastBlock;
-    m_LastPos = src.m_LastPos;
-    src.Clear();
+    *this = std::move(src);
 }
 
 
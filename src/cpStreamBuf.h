@@ -17,6 +17,7 @@
 //  2013-04-22  asc Added conversion assignment operator from Buffer.
 //  2013-08-29  asc Refactored Clear() operation to eliminate inheritance pitfalls.
 //  2022-03-02  asc Added TransferBlocks() method.
+//  2026-10-16  asc Added move constructor and move assignment operator.
 // ----------------------------------------------------------------------------
 #ifndef CP_STREAMBUF_H
 #define CP_STREAMBUF_H
@@ -45,11 +46,15 @@ public:
     // copy constructor
     StreamBuf(StreamBuf &rhs);
 
+    // move constructor
+    StreamBuf(StreamBuf &&rhs);
+
     // destructor
     virtual ~StreamBuf();
 
     // operators
     StreamBuf &operator=(StreamBuf &rhs);                   // overridden assignment operator
+    StreamBuf &operator=(StreamBuf &&rhs);                  // move assignment operator
     StreamBuf &operator=(Buffer const &rhs);                // conversion assignment operator
 
     // accessors
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpStreamMap.cpp
+//
+//  Description:    Memory Mapped File Stream Class.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+
+#include "cpStreamMap.h"
+#include "cpMemMap.h"
+
+namespace cp
+{
+
+// constructor
+StreamMap::StreamMap() :
+    m_PtrMap(NULL),
+    m_MapLen(0),
+    m_Open(false)
+{
+}
+
+
+// constructor
+StreamMap::StreamMap(String const &Path, bool Sequential) :
+    m_PtrMap(NULL),
+    m_MapLen(0),
+    m_Open(false)
+{
+    Open(Path, Sequential);
+}
+
+
+// destructor
+StreamMap::~StreamMap()
+{
+    // unmaps the file
+    MemoryFree();
+}
+
+
+// map a file, hinting sequential access
+bool StreamMap::Open(String const &Path, bool Sequential)
+{
+    void *pMem = NULL;
+    size_t len = 0;
+
+    Close();
+
+    if (MemMap::MapFile(Path.c_str(), pMem, len, Sequential) == false)
+    {
+        LogErr << "StreamMap::Open(): Failed to map file: " << Path
+               << ", instance: " << this << std::endl;
+        return false;
+    }
+
+    m_PtrMap = static_cast<char *>(pMem);
+    m_MapLen = len;
+    m_Open = true;
+
+    // the whole file is data, read from the start
+    m_LastPos = len;
+
+    return true;
+}
+
+
+// unmap the file
+void StreamMap::Close()
+{
+    Clear();
+}
+
+
+// free any allocated storage
+void StreamMap::MemoryFree()
+{
+    if ((m_PtrMap != NULL) && (MemMap::UnmapFile(m_PtrMap, m_MapLen) == false))
+    {
+        LogErr << "StreamMap::MemoryFree(): Failed to unmap file of size: "
+               << m_MapLen << ", instance: " << this << std::endl;
+    }
+
+    m_PtrMap = NULL;
+    m_MapLen = 0;
+    m_Open = false;
+}
+
+
+// add memory to the stream
+bool StreamMap::MemoryAdd(size_t Size)
+{
+    (void)Size;
+
+    LogErr << "StreamMap::MemoryAdd(): A mapped file stream cannot grow, instance: "
+           << this << std::endl;
+
+    return false;
+}
+
+
+// returns true if stream has some memory
+bool StreamMap::MemoryChk() const
+{
+    return (m_PtrMap != NULL);
+}
+
+
+// returns true if block is valid
+bool StreamMap::ValidBlock(size_t Block) const
+{
+    return ((Block == 0) && (m_PtrMap != NULL));
+}
+
+
+// returns block's memory pointer
+char *StreamMap::BlockMemPtr(size_t Block) const
+{
+    return ValidBlock(Block) ? m_PtrMap : NULL;
+}
+
+
+// returns specified memory block size
+size_t StreamMap::BlockSize(size_t Block) const
+{
+    return ValidBlock(Block) ? m_MapLen : 0;
+}
+
+}   // namespace cp
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+//  CodePort++
+//
+//  A Portable Operating System Abstraction Library
+//  Copyright 2026 Amardeep S. Chana.  All rights reserved.
+//  Use of this software is bound by the terms of the Modified BSD License.
+//
+//  Module Name:    cpStreamMap.h
+//
+//  Description:    Memory Mapped File Stream Class.
+//
+//  Platform:       common
+//
+//  History:
+//  2026-10-16  asc Creation.
+// ----------------------------------------------------------------------------
+#ifndef CP_STREAMMAP_H
+#define CP_STREAMMAP_H
+
+#include "cpStreamBase.h"
+
+namespace cp
+{
+
+// ----------------------------------------------------------------------------
+
+// A StreamMap presents a file as a stream by mapping it into memory, so that
+// Datum::Decode(), Crc32Get() and the other stream readers work directly on
+// the operating system's page cache instead of on a copy of the file.  The
+// whole file is one block and the stream is positioned at its start.
+//
+// The pages are mapped copy-on-write: data may be overwritten in place, but
+// changes are private to the stream and are never written back to the file.
+// The stream cannot grow past the end of the file.
+
+// the mapped file stream class
+class StreamMap : public StreamBase
+{
+public:
+    // constructor
+    StreamMap();
+    explicit StreamMap(String const &Path, bool Sequential = true);
+
+    // destructor
+    virtual ~StreamMap();
+
+    // accessors
+    bool IsOpen() const { return m_Open; }                  // true when a file is mapped
+
+    // manipulators
+    bool Open(String const &Path, bool Sequential = true);  // map a file, hinting sequential access
+    void Close();                                           // unmap the file
+
+protected:
+    virtual void MemoryFree();                              // free any allocated storage
+    virtual bool MemoryAdd(size_t Size);                    // add memory to the stream
+    virtual bool MemoryChk() const;                         // returns true if stream has some memory
+    virtual bool ValidBlock(size_t Block) const;            // returns true if block is valid
+    virtual char *BlockMemPtr(size_t Block) const;          // returns block's memory pointer
+    virtual size_t BlockSize(size_t Block) const;           // returns specified memory block size
+
+private:
+    // copy constructor
+    StreamMap(StreamMap &rhs);
+
+    // operators
+    StreamMap &operator=(StreamMap &rhs);
+
+    char               *m_PtrMap;                           // start of the file mapping
+    size_t              m_MapLen;                           // length of the file mapping
+    bool                m_Open;                             // true when a file is mapped
+};
+
+}   // namespace cp
+
+#endif // CP_STREAMMAP_H
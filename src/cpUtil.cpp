@@ -33,13 +33,20 @@
 //  2023-05-02  asc Added NormalizePath().
 //  2023-09-19  asc Added CheckAlphaNumericHU() function.
 //  2024-06-03  asc Added DeleteFile() function.
+//  2026-10-16  asc Accepted BufferView in HexDump(), HexEncode() and CRC functions.
+//  2026-10-16  asc Skipped zero fill of the ReadFile() buffer.
+//  2026-10-16  asc Moved CRC-32 calculation onto the table and folding engine.
+//  2026-10-16  asc Moved CRC-16 calculation onto lookup tables.
+//  2026-10-16  asc Formatted HexDump() lines into a text block with a vector hex kernel.
+//  2026-10-16  asc Moved numeric string conversions onto the buffer conversions.
 // ----------------------------------------------------------------------------
 
 #include <fstream>
-#include <cinttypes>
 
 #include "cpUtil.h"
 #include "cpBuffer.h"
+#include "cpCrc.h"
+#include "cpSimd.h"
 
 namespace cp
 {
@@ -86,6 +93,13 @@ bool HexDump(std::ostream &Out, Buffer const &Buf, size_t LineLen)
 }
 
 
+// dump a block of data to a stream in Hex ASCII format
+bool HexDump(std::ostream &Out, BufferView const &View, size_t LineLen)
+{
+    return HexDump(Out, View.u_str(), View.LenGet(), LineLen);
+}
+
+
 // dump a block of data to a stream in Hex ASCII format
 bool HexDump(std::ostream &Out, char const *Data, size_t DataLen, size_t LineLen)
 {
@@ -96,52 +110,79 @@ bool HexDump(std::ostream &Out, char const *Data, size_t DataLen, size_t LineLen
 // dump a block of data to a stream in Hex ASCII format
 bool HexDump(std::ostream &Out, uint8_t const *Data, size_t DataLen, size_t LineLen)
 {
+    static size_t const flushLen = 8192;
     size_t line;
     size_t chr;
+    size_t num;
+    size_t digits;
+    char *pOut;
+    String text;
+    String hex;
 
-    if (Data == NULL)
+    if ((Data == NULL) || (LineLen == 0))
     {
         return false;
     }
 
+    hex.resize(2 * LineLen);
+
+    // lines are formatted into a text block that is written out when full
     for (line = 0; line < DataLen; line += LineLen)
     {
-        Out << std::hex << std::setw(4) << std::setfill('0') << line << ": ";
+        num = ((DataLen - line) < LineLen) ? (DataLen - line) : LineLen;
 
-        for (chr = 0; chr < LineLen; ++chr)
+        // the offset has at least four hex digits
+        digits = 4;
+
+        while ((digits < (2 * sizeof(line))) && ((line >> (4 * digits)) != 0))
         {
-            if ((line + chr) < DataLen)
-            {
-                Out << " " << std::hex << std::setw(2) << std::setfill('0') << (uint16_t)(Data[line + chr]);
-            }
-            else
-            {
-                Out << "   ";
-            }
+            ++digits;
+        }
+
+        HexEncodeArray(&hex[0], Data + line, num);
+
+        // offset, ": ", octet columns, two spaces, characters, newline
+        chr = text.size();
+        text.resize(chr + digits + 2 + (3 * LineLen) + 2 + num + 1);
+        pOut = &text[chr];
+
+        for (chr = digits; chr > 0; --chr)
+        {
+            *pOut++ = "0123456789abcdef"[(line >> (4 * (chr - 1))) & 0x0f];
         }
 
-        Out << "  ";
+        *pOut++ = ':';
+        *pOut++ = ' ';
 
         for (chr = 0; chr < LineLen; ++chr)
         {
-            if ((line + chr) < DataLen)
-            {
-                uint8_t c = Data[line + chr];
+            *pOut++ = ' ';
+            *pOut++ = (chr < num) ? hex[2 * chr] : ' ';
+            *pOut++ = (chr < num) ? hex[(2 * chr) + 1] : ' ';
+        }
 
-                if ((c >= ' ') && (c < CHAR_DEL))
-                {
-                    Out << static_cast<char>(c);
-                }
-                else
-                {
-                    Out << ".";
-                }
-            }
+        *pOut++ = ' ';
+        *pOut++ = ' ';
+
+        for (chr = 0; chr < num; ++chr)
+        {
+            uint8_t c = Data[line + chr];
+
+            *pOut++ = ((c >= ' ') && (c < CHAR_DEL)) ? static_cast<char>(c) : '.';
         }
 
-        Out << std::dec << std::endl;
+        *pOut = '\n';
+
+        if (text.size() >= flushLen)
+        {
+            Out.write(text.data(), text.size());
+            text.clear();
+        }
     }
 
+    Out.write(text.data(), text.size());
+    Out.flush();
+
     return Out.good();
 }
 
@@ -270,28 +311,44 @@ String &Rchomp(String &Str, size_t Count)
 // converts string to long integer
 int32_t StrToInt(String const &Str)
 {
-    return strtol(Str.c_str(), NULL, 10);
+    int64_t val = 0;
+
+    CharsToInt(Str.c_str(), Str.size(), val);
+
+    return static_cast<int32_t>(val);
 }
 
 
 // converts string to unsigned long integer
 uint32_t StrToUint(String const &Str)
 {
-    return strtoul(Str.c_str(), NULL, 10);
+    uint64_t val = 0;
+
+    CharsToUint(Str.c_str(), Str.size(), val);
+
+    return static_cast<uint32_t>(val);
 }
 
 
 // converts string to long long integer
 int64_t StrToInt64(String const &Str)
 {
-    return strtoll(Str.c_str(), NULL, 10);
+    int64_t val = 0;
+
+    CharsToInt(Str.c_str(), Str.size(), val);
+
+    return val;
 }
 
 
 // converts string to unsigned long long integer
 uint64_t StrToUint64(String const &Str)
 {
-    return strtoull(Str.c_str(), NULL, 10);
+    uint64_t val = 0;
+
+    CharsToUint(Str.c_str(), Str.size(), val);
+
+    return val;
 }
 
 
@@ -332,55 +389,54 @@ bool StrToBool(String const &Str)
 // converts integer to string
 String IntToStr(int Val)
 {
-    Buffer buf(32);
+    char buf[k_NumTextLen];
 
-    snprintf(buf, buf, "%d", Val);
-
-    return buf.c_str();
+    return String(buf, IntToChars(buf, Val));
 }
 
 
 // converts unsigned to string integer
 String UintToStr(uint32_t Val)
 {
-    Buffer buf(32);
-
-    snprintf(buf, buf, "%u", Val);
+    char buf[k_NumTextLen];
 
-    return buf.c_str();
+    return String(buf, UintToChars(buf, Val));
 }
 
 
 // converts integer to string
 String Int64ToStr(int64_t Val)
 {
-    Buffer buf(64);
-
-    snprintf(buf, buf, "%" PRId64, Val);
+    char buf[k_NumTextLen];
 
-    return buf.c_str();
+    return String(buf, IntToChars(buf, Val));
 }
 
 
 // converts unsigned to string integer
 String Uint64ToStr(uint64_t Val)
 {
-    Buffer buf(64);
+    char buf[k_NumTextLen];
 
-    snprintf(buf, buf, "%" PRIu64, Val);
-
-    return buf.c_str();
+    return String(buf, UintToChars(buf, Val));
 }
 
 
 // converts float to string
 String FloatToStr(double Val)
 {
-    Buffer buf(32);
+    char buf[k_NumTextLen];
+
+    return String(buf, FloatToChars(buf, Val));
+}
 
-    snprintf(buf, buf, "%f", Val);
 
-    return buf.c_str();
+// converts float to string
+String FloatToStr(float Val)
+{
+    char buf[k_NumTextLen];
+
+    return String(buf, FloatToChars(buf, Val));
 }
 
 
@@ -541,12 +597,19 @@ uint32_t Reflect32(uint32_t Val)
 
 
 // calculate CRC-16 for a block of data
-uint16_t CalcCrc16(Buffer &Buf, uint16_t Cascade)
+uint16_t CalcCrc16(Buffer const &Buf, uint16_t Cascade)
 {
     return CalcCrc16(Buf.u_str(), Buf.LenGet(), Cascade);
 }
 
 
+// calculate CRC-16 for a block of data
+uint16_t CalcCrc16(BufferView const &View, uint16_t Cascade)
+{
+    return CalcCrc16(View.u_str(), View.LenGet(), Cascade);
+}
+
+
 // calculate CRC-16 for a block of data
 uint16_t CalcCrc16(char const *pBuf, size_t Size, uint16_t Cascade)
 {
@@ -557,45 +620,27 @@ uint16_t CalcCrc16(char const *pBuf, size_t Size, uint16_t Cascade)
 // calculate CRC-16 for a block of data
 uint16_t CalcCrc16(uint8_t const *pBuf, size_t Size, uint16_t Cascade)
 {
-    uint16_t xorOut    = 0;
-    uint16_t remainder = Cascade;
-    uint16_t mask      = 0x8000;
-    uint16_t gen       = 0x1021;
-    size_t shift       = 8;
-
     // check for NULL pointer
     if (pBuf == NULL)
     {
         return 0;
     }
 
-    // process the input octets
-    for (size_t byte = 0; byte < Size; ++byte)
-    {
-        remainder ^= ((*pBuf++) << shift);
+    return Crc16Update(Cascade, pBuf, Size);
+}
 
-        // divide by the generator and save the remainder
-        for (size_t bit = 0; bit < 8; ++bit)
-        {
-            if (remainder & mask)
-            {
-                remainder = (remainder << 1) ^ gen;
-            }
-            else
-            {
-                remainder = (remainder << 1);
-            }
-        }
-    }
 
-    return (remainder ^ xorOut);
+// calculate CRC-32 for a block of data
+uint32_t CalcCrc32(Buffer const &Buf, uint32_t Cascade)
+{
+    return CalcCrc32(Buf.u_str(), Buf.LenGet(), Cascade);
 }
 
 
 // calculate CRC-32 for a block of data
-uint32_t CalcCrc32(Buffer &Buf, uint32_t Cascade)
+uint32_t CalcCrc32(BufferView const &View, uint32_t Cascade)
 {
-    return CalcCrc32(Buf.u_str(), Buf.LenGet(), Cascade);
+    return CalcCrc32(View.u_str(), View.LenGet(), Cascade);
 }
 
 
@@ -611,9 +656,6 @@ uint32_t CalcCrc32(uint8_t const *pBuf, size_t Size, uint32_t Cascade)
 {
     uint32_t xorOut    = 0xffffffff;
     uint32_t remainder = xorOut;
-    uint32_t mask      = 0x80000000;
-    uint32_t gen       = 0x04c11db7;
-    size_t shift       = 24;
 
     // check for NULL pointer
     if (pBuf == NULL)
@@ -624,29 +666,10 @@ uint32_t CalcCrc32(uint8_t const *pBuf, size_t Size, uint32_t Cascade)
     // check for data cascade
     if (Cascade != xorOut)
     {
-        remainder = Reflect32((Cascade ^ xorOut));
-    }
-
-    // process the input octets
-    for (size_t byte = 0; byte < Size; ++byte)
-    {
-        remainder ^= (Reflect8(*pBuf++) << shift);
-
-        // divide by the generator and save the remainder
-        for (size_t bit = 0; bit < 8; ++bit)
-        {
-            if (remainder & mask)
-            {
-                remainder = (remainder << 1) ^ gen;
-            }
-            else
-            {
-                remainder = (remainder << 1);
-            }
-        }
+        remainder = Cascade ^ xorOut;
     }
 
-    return (Reflect32(remainder) ^ xorOut);
+    return (Crc32Update(remainder, pBuf, Size) ^ xorOut);
 }
 
 
@@ -921,7 +944,7 @@ size_t ReadFile(String const &Path, Buffer &FileData)
 
         if (fileLen > 0)
         {
-            if (FileData.Resize(fileLen))
+            if (FileData.Resize(fileLen, false))
             {
                 dataFile.seekg(0);
                 dataFile.read(FileData, fileLen);
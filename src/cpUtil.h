@@ -36,6 +36,9 @@
 //  2023-08-10  asc Removed string parameter from HostName() and DomainName() functions.
 //  2023-09-19  asc Added CheckAlphaNumericHU() function.
 //  2024-06-03  asc Added DeleteFile() function.
+//  2026-10-16  asc Accepted BufferView in HexDump(), HexEncode() and CRC functions.
+//  2026-10-16  asc Added HexDigitVal().
+//  2026-10-16  asc Added numeric text conversion into caller supplied buffers.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_UTIL_H
@@ -48,6 +51,7 @@ namespace cp
 {
 
 class Buffer;
+class BufferView;
 
 // ----------------------------------------------------------------------------
 
@@ -92,6 +96,14 @@ public:
 
 // ----------------------------------------------------------------------------
 
+// numeric text conversion
+enum NumText
+{
+    k_NumTextLen = 32       // buffer size that holds any number converted by the ...ToChars() functions
+};
+
+// ----------------------------------------------------------------------------
+
 // ASCII standard control codes
 enum AsciiControlCodes
 {
@@ -141,15 +153,19 @@ bool PathCreate(String const &PathName);
 
 // dump a block of data to a stream in Hex ASCII format
 bool HexDump(std::ostream &Out, Buffer const &Buf, size_t LineLen = 16);
+bool HexDump(std::ostream &Out, BufferView const &View, size_t LineLen = 16);
 bool HexDump(std::ostream &Out, char const *Data, size_t DataLen, size_t LineLen = 16);
 bool HexDump(std::ostream &Out, uint8_t const *Data, size_t DataLen, size_t LineLen = 16);
 
 // Encode a block of data to ASCII hex
-size_t HexEncode(Buffer const &Input, String &Output, HexIoCfg &Form);
+size_t HexEncode(BufferView const &Input, String &Output, HexIoCfg &Form);
 
 // decode a block of ASCII hex data
 size_t HexDecode(String const &Input, Buffer &Output);
 
+// return the value of a hex digit, or -1 if it is not one
+int HexDigitVal(char Ch);
+
 // returns a string with the specified number of characters
 String const GenStr(size_t Count, char Ch = ' ');
 
@@ -195,12 +211,34 @@ String Int64ToStr(int64_t Val);
 // converts unsigned to string integer
 String Uint64ToStr(uint64_t Val);
 
-// converts float to string
+// converts float to string (shortest text that reads back as the same value)
 String FloatToStr(double Val);
+String FloatToStr(float Val);
 
 // converts boolean to string
 String BoolToStr(bool Val);
 
+// converts integer to decimal text in a buffer of k_NumTextLen characters,
+// returning the text length (a terminator is also written)
+size_t IntToChars(char *pBuf, int64_t Val);
+
+// converts unsigned integer to decimal text in a buffer of k_NumTextLen characters,
+// returning the text length (a terminator is also written)
+size_t UintToChars(char *pBuf, uint64_t Val);
+
+// converts float to the shortest text that reads back as the same value in a
+// buffer of k_NumTextLen characters, returning the text length (a terminator is also written)
+size_t FloatToChars(char *pBuf, double Val);
+size_t FloatToChars(char *pBuf, float Val);
+
+// converts decimal text to integer like strtoll(), returning the number of
+// characters used or zero if there is no number
+size_t CharsToInt(char const *pStr, size_t Len, int64_t &Val);
+
+// converts decimal text to unsigned integer like strtoull(), returning the
+// number of characters used or zero if there is no number
+size_t CharsToUint(char const *pStr, size_t Len, uint64_t &Val);
+
 // tokenize a string into a vector of strings
 size_t Tokenize(String const &StringIn, String const &Delim, StringVec_t &TokensOut);
 
@@ -217,12 +255,14 @@ uint16_t Reflect16(uint16_t Val);
 uint32_t Reflect32(uint32_t Val);
 
 // calculate CRC-16 for a block of data
-uint16_t CalcCrc16(Buffer &Buf, uint16_t Cascade = 0xffff);
+uint16_t CalcCrc16(Buffer const &Buf, uint16_t Cascade = 0xffff);
+uint16_t CalcCrc16(BufferView const &View, uint16_t Cascade = 0xffff);
 uint16_t CalcCrc16(char const *pBuf, size_t Size, uint16_t Cascade = 0xffff);
 uint16_t CalcCrc16(uint8_t const *pBuf, size_t Size, uint16_t Cascade = 0xffff);
 
 // calculate CRC-32 for a block of data
-uint32_t CalcCrc32(Buffer &Buf, uint32_t Cascade = 0xffffffff);
+uint32_t CalcCrc32(Buffer const &Buf, uint32_t Cascade = 0xffffffff);
+uint32_t CalcCrc32(BufferView const &View, uint32_t Cascade = 0xffffffff);
 uint32_t CalcCrc32(char const *pBuf, size_t Size, uint32_t Cascade = 0xffffffff);
 uint32_t CalcCrc32(uint8_t const *pBuf, size_t Size, uint32_t Cascade = 0xffffffff);
 
@@ -20,6 +20,9 @@
 //  2013-06-28  asc Added Clear() method.
 //  2013-07-19  asc Added inert state.
 //  2014-03-30  asc Inserted newline before hex dump of blob data.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Skipped zero fill when resizing for a new value.
+//  2026-10-16  asc Converted 64-bit values to and from text without truncation.
 // ----------------------------------------------------------------------------
 
 #include "cpVariant.h"
@@ -57,6 +60,15 @@ Variant::Variant(Variant const &rhs) :
 }
 
 
+// move constructor
+Variant::Variant(Variant &&rhs) :
+    m_Type(dt_none)
+{
+    // invoke move assignment operator
+    *this = std::move(rhs);
+}
+
+
 // operators
 Variant &Variant::operator=(Variant const &rhs)
 {
@@ -71,6 +83,28 @@ Variant &Variant::operator=(Variant const &rhs)
 }
 
 
+Variant &Variant::operator=(Variant &&rhs)
+{
+    // an inert source is shared and must not be emptied
+    if (rhs.m_Type == dt_inert)
+    {
+        return *this = rhs;
+    }
+
+    // check for self assignment or inert state
+    if ((this != &rhs) && (m_Type != dt_inert))
+    {
+        m_Type = rhs.m_Type;
+        m_Buf  = std::move(rhs.m_Buf);
+
+        // leave the source in the cleared state
+        rhs.m_Type = dt_none;
+    }
+
+    return *this;
+}
+
+
 // setters
 void Variant::Uint8Set(uint8_t Val)
 {
@@ -258,7 +292,7 @@ uint64_t Variant::Uint64Get() const
         break;
 
     case dt_string:
-        rv = cp::StrToUint(DataBuffer());
+        rv = cp::StrToUint64(DataBuffer());
         break;
 
     case dt_blob:
@@ -476,11 +510,11 @@ String Variant::StrGet() const
         break;
 
     case dt_uint64:
-        rv = cp::UintToStr(*reinterpret_cast<uint64_t const *>(DataBuffer()));
+        rv = cp::Uint64ToStr(*reinterpret_cast<uint64_t const *>(DataBuffer()));
         break;
 
     case dt_int64:
-        rv = cp::IntToStr(*reinterpret_cast<int64_t const *>(DataBuffer()));
+        rv = cp::Int64ToStr(*reinterpret_cast<int64_t const *>(DataBuffer()));
         break;
 
     case dt_float32:
@@ -516,7 +550,7 @@ bool Variant::ResizeBuffer(size_t Size)
 {
     bool rv = (m_Type != dt_inert);
 
-    rv = rv && m_Buf.Resize(Size);
+    rv = rv && m_Buf.Resize(Size, false);
 
     if (rv)
     {
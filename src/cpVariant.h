@@ -18,6 +18,8 @@
 //  2012-11-30  asc Added additional native data types for function call support.
 //  2013-06-28  asc Added Clear() method.
 //  2013-07-19  asc Added inert state.
+//  2026-10-16  asc Added move constructor and move assignment operator.
+//  2026-10-16  asc Added blob access through BufferView.
 // ----------------------------------------------------------------------------
 
 #ifndef CP_VARIANT_H
@@ -48,11 +50,15 @@ public:
     // copy constructor
     Variant(Variant const &rhs);
 
+    // move constructor
+    Variant(Variant &&rhs);
+
     // destructor
     virtual ~Variant() {}
 
     // operators
     Variant &operator=(Variant const &rhs);
+    Variant &operator=(Variant &&rhs);
 
     // setters
     void Uint8Set(uint8_t   Val);
@@ -69,7 +75,9 @@ public:
     void BoolSet(bool Val);
     void StrSet(String const &Str) { m_Buf = Str; TypeSet(dt_string); }
     void BufSet(Buffer const &Buf) { m_Buf = Buf; TypeSet(dt_blob); }
+    void BufSet(Buffer &&Buf) { m_Buf = std::move(Buf); TypeSet(dt_blob); }
     void BufSet(uint8_t const *pBuf, size_t Len) { m_Buf.CopyIn(pBuf, Len); TypeSet(dt_blob); }
+    void BufSet(BufferView const &View) { BufSet(View.u_str(), View.LenGet()); }
 
     // getters
     uint8_t  Uint8Get()   const;
@@ -87,6 +95,7 @@ public:
     String StrGet() const;
     Buffer &BufGet() { return m_Buf; }
     Buffer const &BufGet() const { return m_Buf; }
+    BufferView BufView() const { return BufferView(m_Buf); }
 
     // management methods
     DataType_t TypeGet() const { return m_Type; }